@@ -0,0 +1,26 @@
+#include "emblib/dsp/kalman.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("Kalman benchmark", "[dsp][kalman][benchmark]")
+{
+    using emblib::dsp::kalman;
+    using emblib::math::matrixf;
+    using emblib::math::vectorf;
+
+    matrixf<3> F = {{1, 2, 3}, {-2, -4, 0}, {2, -1, 1}};
+    vectorf<3> u = {1, 0, -1};
+    matrixf<4, 3> H = {{1, 3, 7}, {4, 2, -1}, {-1, 2, 0}, {5, 0, -3}};
+    vectorf<4> z = {2, -1, 3, 1};
+    matrixf<3> Q = matrixf<3>::diagonal();
+    matrixf<4> R = matrixf<4>::diagonal();
+
+    BENCHMARK_ADVANCED("kalman linear update 3x4")(Catch::Benchmark::Chronometer meter)
+    {
+        kalman<3> kalman3({1, 1, 1});
+        meter.measure([&] {
+            kalman3.update<4>(F, u, H, Q, R, z);
+            return kalman3.get_state()(0);
+        });
+    };
+}
@@ -0,0 +1,166 @@
+#include "emblib/math/matrix.hpp"
+#include "emblib/math/matrix_batch.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <cmath>
+#include <vector>
+
+TEST_CASE("Matrix benchmark", "[math][matrix][benchmark]")
+{
+    using emblib::math::matrixf;
+
+    matrixf<3> a {{2, 0, 1}, {1, 3, 2}, {1, 1, 2}};
+    matrixf<3> b {{1, 2, 3}, {4, 5, 6}, {7, 8, 10}};
+    matrixf<4> c {{4, 1, 0, 0}, {1, 4, 1, 0}, {0, 1, 4, 1}, {0, 0, 1, 4}};
+    matrixf<4, 3> d {{1, 3, 7}, {4, 2, -1}, {-1, 2, 0}, {5, 0, -3}};
+
+    BENCHMARK("matmul 3x3")
+    {
+        return matrixf<3>(a.matmul(b));
+    };
+
+    BENCHMARK("matmul 4x3 3x3")
+    {
+        return matrixf<4, 3>(d.matmul(a));
+    };
+
+    BENCHMARK("transpose matmul 3x4 4x3")
+    {
+        return matrixf<3>(d.transpose().matmul(d));
+    };
+
+    BENCHMARK("element-wise 3x3")
+    {
+        return matrixf<3>(a * b + a - b);
+    };
+
+    BENCHMARK("inverse 3x3")
+    {
+        return matrixf<3>(a.inverse());
+    };
+
+    BENCHMARK("determinant 4x4")
+    {
+        return c.determinant();
+    };
+
+    BENCHMARK("matdivl 3x3")
+    {
+        return matrixf<3>(b.matdivl(a));
+    };
+
+    BENCHMARK("matdivl 4x4 4x3")
+    {
+        return matrixf<4, 3>(d.matdivl(c));
+    };
+
+    BENCHMARK("matdivl direct 3x3")
+    {
+        return matrixf<3>(b.matdivl<emblib::math::solver_e::DIRECT>(a));
+    };
+
+    BENCHMARK("matdivl direct 4x4 4x3")
+    {
+        return matrixf<4, 3>(d.matdivl<emblib::math::solver_e::DIRECT>(c));
+    };
+}
+
+TEST_CASE("Matrix batch benchmark", "[math][matrix][benchmark]")
+{
+    using emblib::math::matrixf;
+    using emblib::math::matrixf_batch;
+
+    constexpr size_t BATCH_SIZE = 32;
+
+    matrixf<3> a {{2, 0, 1}, {1, 3, 2}, {1, 1, 2}};
+    matrixf<3> b {{1, 2, 3}, {4, 5, 6}, {7, 8, 10}};
+    std::vector<matrixf<3>> a_array(BATCH_SIZE, a);
+    std::vector<matrixf<3>> b_array(BATCH_SIZE, b);
+    std::vector<matrixf<3>> result(BATCH_SIZE, matrixf<3>(0.f));
+    matrixf_batch<3, 3, BATCH_SIZE> a_batch;
+    matrixf_batch<3, 3, BATCH_SIZE> b_batch;
+    for (size_t i = 0; i < BATCH_SIZE; i++) {
+        a_batch.set_matrix(i, a);
+        b_batch.set_matrix(i, b);
+    }
+
+    BENCHMARK("matmul 3x3 x32 loop")
+    {
+        for (size_t i = 0; i < BATCH_SIZE; i++)
+            result[i] = a_array[i].matmul(b_array[i]);
+        return result[BATCH_SIZE - 1];
+    };
+
+    BENCHMARK("matmul 3x3 x32 batch")
+    {
+        return a_batch.matmul(b_batch);
+    };
+
+    BENCHMARK("matdivl 3x3 x32 loop")
+    {
+        for (size_t i = 0; i < BATCH_SIZE; i++)
+            result[i] = b_array[i].matdivl(a_array[i]);
+        return result[BATCH_SIZE - 1];
+    };
+
+    BENCHMARK("matdivl 3x3 x32 batch")
+    {
+        return b_batch.matdivl(a_batch);
+    };
+}
+
+TEST_CASE("Matrix accumulation benchmark", "[math][matrix][benchmark]")
+{
+    using emblib::math::accumulate_e;
+    using emblib::math::matrix;
+    using emblib::math::matrixf;
+
+    constexpr size_t INNER_DIM = 256;
+
+    /* Terms of different magnitudes so that the rounding error of the sum is visible */
+    matrixf<4, INNER_DIM> a {0.f};
+    matrixf<INNER_DIM, 4> b {0.f};
+    for (size_t r = 0; r < 4; r++) {
+        for (size_t i = 0; i < INNER_DIM; i++) {
+            a(r, i) = (i % 2 ? 1e4f : 3e-1f) * (1 + 0.1f * r);
+            b(i, r) = 1.f + 1e-3f * i;
+        }
+    }
+    const matrix<double, 4> reference = a.cast<double>().matmul(b.cast<double>());
+
+    /* Error relative to the correctly rounded result */
+    auto max_error = [&reference](const matrixf<4>& result) {
+        double error = 0;
+        for (size_t r = 0; r < 4; r++) {
+            for (size_t c = 0; c < 4; c++) {
+                const float rounded = reference(r, c);
+                error = std::max(error, (double)std::abs(result(r, c) - rounded));
+            }
+        }
+        return error;
+    };
+
+    const double error_native = max_error(a.matmul<accumulate_e::NATIVE>(b));
+    const double error_double = max_error(a.matmul<accumulate_e::DOUBLE>(b));
+    const double error_kahan = max_error(a.matmul<accumulate_e::KAHAN>(b));
+    WARN("matmul 4x256x4 max abs error: native " << error_native
+        << ", double " << error_double << ", kahan " << error_kahan);
+    CHECK(error_double <= error_native);
+    CHECK(error_kahan <= error_native);
+
+    BENCHMARK("matmul 4x256x4 native accumulation")
+    {
+        return matrixf<4>(a.matmul<accumulate_e::NATIVE>(b));
+    };
+
+    BENCHMARK("matmul 4x256x4 double accumulation")
+    {
+        return matrixf<4>(a.matmul<accumulate_e::DOUBLE>(b));
+    };
+
+    BENCHMARK("matmul 4x256x4 kahan accumulation")
+    {
+        return matrixf<4>(a.matmul<accumulate_e::KAHAN>(b));
+    };
+}
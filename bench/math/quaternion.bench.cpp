@@ -0,0 +1,23 @@
+#include "emblib/math/quaternion.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("Quaternion benchmark", "[math][quaternion][benchmark]")
+{
+    using emblib::math::quaternionf;
+    using emblib::math::vector3f;
+
+    quaternionf q1 {0.5f, 0.5f, 0.5f, 0.5f};
+    quaternionf q2 {0.f, 1.f, 0.f, 0.f};
+    vector3f v {1, 0, -1};
+
+    BENCHMARK("quaternion multiply")
+    {
+        return q1 * q2;
+    };
+
+    BENCHMARK("quaternion rotate vector")
+    {
+        return q1.rotate_vec(v);
+    };
+}
@@ -0,0 +1,34 @@
+#include "emblib/math/vector.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("Vector benchmark", "[math][vector][benchmark]")
+{
+    using emblib::math::vector3f;
+    using emblib::math::vectorf;
+
+    vector3f a {1, 2, 3};
+    vector3f b {7, 6, 5};
+    vectorf<4> c {1, 2, 3, 4};
+    vectorf<4> d {7, 6, 5, 4};
+
+    BENCHMARK("dot 3")
+    {
+        return a.dot(b);
+    };
+
+    BENCHMARK("dot 4")
+    {
+        return c.dot(d);
+    };
+
+    BENCHMARK("cross 3")
+    {
+        return a.cross(b);
+    };
+
+    BENCHMARK("normalized 3")
+    {
+        return a.normalized();
+    };
+}
@@ -0,0 +1,84 @@
+#include "emblib/rtos/executor.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <chrono>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t JOB_COUNT = 20000;
+constexpr size_t JOB_WORK = 2000;
+constexpr size_t STACK_SIZE = 32 * 1024;
+
+static std::atomic<size_t> jobs_done {0};
+static emblib::rtos::semaphore all_done;
+
+static emblib::rtos::executor<1, 64, STACK_SIZE> executor_1("executor_1", 2);
+static emblib::rtos::executor<2, 64, STACK_SIZE> executor_2("executor_2", 2);
+static emblib::rtos::executor<4, 64, STACK_SIZE> executor_4("executor_4", 2);
+
+static double jobs_per_second[3] = {0};
+
+/**
+ * Job with a fixed amount of work which signals when the last one is done
+ */
+static void job() noexcept
+{
+    volatile uint32_t acc = 0;
+    for (size_t i = 0; i < JOB_WORK; i++)
+        acc += i;
+    if (jobs_done.fetch_add(1) + 1 == JOB_COUNT) {
+        all_done.give();
+    }
+}
+
+template <typename executor_type>
+static double measure(executor_type& executor) noexcept
+{
+    jobs_done = 0;
+    const auto start = clock_type::now();
+    for (size_t i = 0; i < JOB_COUNT; i++) {
+        while (!executor.post(&job)) {
+            emblib::rtos::task::sleep(emblib::rtos::ticks_t(0));
+        }
+    }
+    all_done.take();
+    const std::chrono::duration<double> elapsed = clock_type::now() - start;
+    return JOB_COUNT / elapsed.count();
+}
+
+/**
+ * Posts the jobs from a lower priority than the workers, so the workers
+ * run as soon as there is work and the poster only fills the queue
+ */
+class poster_task : public emblib::rtos::task {
+public:
+    poster_task() : task("poster", 1, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        jobs_per_second[0] = measure(executor_1);
+        jobs_per_second[1] = measure(executor_2);
+        jobs_per_second[2] = measure(executor_4);
+        emblib::rtos::task::stop_tasks();
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+}
+
+TEST_CASE("Executor throughput benchmark", "[rtos][executor][benchmark][scheduler]")
+{
+    static poster_task poster;
+
+    emblib::rtos::task::start_tasks();
+
+    WARN("executor 1 worker:  " << jobs_per_second[0] << " jobs/s");
+    WARN("executor 2 workers: " << jobs_per_second[1] << " jobs/s");
+    WARN("executor 4 workers: " << jobs_per_second[2] << " jobs/s");
+    REQUIRE(jobs_done == JOB_COUNT);
+}
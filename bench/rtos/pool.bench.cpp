@@ -0,0 +1,54 @@
+#include "emblib/rtos/pool.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <FreeRTOS.h>
+#include <task.h>
+#include <cstdlib>
+
+TEST_CASE("Pool benchmark", "[rtos][pool][benchmark]")
+{
+    constexpr size_t BURST_SIZE = 32;
+
+    struct message_s {
+        uint32_t id;
+        uint8_t payload[60];
+    };
+
+    static emblib::rtos::pool<message_s, BURST_SIZE> message_pool;
+    void* blocks[BURST_SIZE];
+
+    BENCHMARK("pool allocate/free 32")
+    {
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            blocks[i] = message_pool.allocate();
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            message_pool.free(blocks[i]);
+        return blocks[BURST_SIZE - 1];
+    };
+
+    /* Same as heap_3 pvPortMalloc/vPortFree, which builds without
+     * configSUPPORT_DYNAMIC_ALLOCATION, unlike the other FreeRTOS heaps */
+    BENCHMARK("malloc/free 32 with scheduler suspended")
+    {
+        for (size_t i = 0; i < BURST_SIZE; i++) {
+            vTaskSuspendAll();
+            blocks[i] = std::malloc(sizeof(message_s));
+            xTaskResumeAll();
+        }
+        for (size_t i = 0; i < BURST_SIZE; i++) {
+            vTaskSuspendAll();
+            std::free(blocks[i]);
+            xTaskResumeAll();
+        }
+        return blocks[BURST_SIZE - 1];
+    };
+
+    BENCHMARK("malloc/free 32")
+    {
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            blocks[i] = std::malloc(sizeof(message_s));
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            std::free(blocks[i]);
+        return blocks[BURST_SIZE - 1];
+    };
+}
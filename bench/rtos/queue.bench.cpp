@@ -0,0 +1,118 @@
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/task.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <chrono>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t BURST_SIZE = 64;
+constexpr size_t BURST_COUNT = 2000;
+constexpr size_t STACK_SIZE = 32 * 1024;
+
+static emblib::rtos::queue<int16_t, BURST_SIZE> sample_queue;
+static emblib::rtos::semaphore start(1, 0);
+static emblib::rtos::semaphore done(1, 0);
+static bool use_batch = false;
+
+static double bursts_per_second[2] = {0};
+
+/**
+ * Higher priority consumer, which is woken up by the first item of a burst
+ */
+class consumer_task : public emblib::rtos::task {
+public:
+    consumer_task() : task("consumer", 2, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        int16_t samples[BURST_SIZE];
+        while (true) {
+            size_t received = 0;
+            while (received < BURST_SIZE) {
+                received += sample_queue.receive_n(samples + received, BURST_SIZE - received);
+            }
+            done.give();
+        }
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+/**
+ * Sends the bursts either item by item or with `send_n`
+ */
+class producer_task : public emblib::rtos::task {
+public:
+    producer_task() : task("producer", 1, m_stack) {}
+
+private:
+    double measure(bool batch) noexcept
+    {
+        const int16_t samples[BURST_SIZE] = {0};
+        const auto begin = clock_type::now();
+        for (size_t i = 0; i < BURST_COUNT; i++) {
+            if (batch) {
+                sample_queue.send_n(samples, BURST_SIZE);
+            }
+            else {
+                for (size_t j = 0; j < BURST_SIZE; j++)
+                    sample_queue.send(samples[j]);
+            }
+            done.take();
+        }
+        const std::chrono::duration<double> elapsed = clock_type::now() - begin;
+        return BURST_COUNT / elapsed.count();
+    }
+
+    void run() noexcept override
+    {
+        bursts_per_second[0] = measure(false);
+        bursts_per_second[1] = measure(true);
+        emblib::rtos::task::stop_tasks();
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+}
+
+TEST_CASE("Queue batch benchmark", "[rtos][queue][benchmark]")
+{
+    using emblib::rtos::ticks_t;
+
+    int16_t samples[BURST_SIZE] = {0};
+
+    /* Without a waiting receiver there is nothing to save, since
+     * each item is still sent through the kernel separately */
+    BENCHMARK("queue burst 64 item by item")
+    {
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            sample_queue.send(samples[i], ticks_t(0));
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            sample_queue.receive(samples[i], ticks_t(0));
+        return samples[BURST_SIZE - 1];
+    };
+
+    BENCHMARK("queue burst 64 send_n receive_n")
+    {
+        sample_queue.send_n(samples, BURST_SIZE, ticks_t(0));
+        return sample_queue.receive_n(samples, BURST_SIZE, ticks_t(0));
+    };
+}
+
+TEST_CASE("Queue batch wake up benchmark", "[rtos][queue][benchmark][scheduler]")
+{
+    static consumer_task consumer;
+    static producer_task producer;
+
+    emblib::rtos::task::start_tasks();
+
+    WARN("send x64: " << bursts_per_second[0] << " bursts/s");
+    WARN("send_n:   " << bursts_per_second[1] << " bursts/s");
+    REQUIRE(bursts_per_second[1] > 0);
+}
@@ -0,0 +1,147 @@
+#include "emblib/rtos/mutex.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/shared_mutex.hpp"
+#include "emblib/rtos/task.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <chrono>
+#include <mutex>
+#include <shared_mutex>
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+constexpr size_t READER_COUNT = 4;
+constexpr size_t READ_COUNT = 20000;
+constexpr size_t WRITE_COUNT = 200;
+constexpr size_t TABLE_SIZE = 64;
+constexpr size_t STACK_SIZE = 32 * 1024;
+
+static emblib::rtos::mutex table_mutex;
+static emblib::rtos::shared_mutex table_shared_mutex;
+static volatile uint32_t table[TABLE_SIZE];
+static bool use_shared = false;
+
+static emblib::rtos::semaphore start(READER_COUNT + 1, 0);
+static emblib::rtos::semaphore done(READER_COUNT + 1, 0);
+
+static double reads_per_second[2] = {0};
+
+static uint32_t read_table() noexcept
+{
+    uint32_t sum = 0;
+    for (size_t i = 0; i < TABLE_SIZE; i++)
+        sum += table[i];
+    return sum;
+}
+
+static void write_table(uint32_t value) noexcept
+{
+    for (size_t i = 0; i < TABLE_SIZE; i++)
+        table[i] = value;
+}
+
+/**
+ * Reads the table under either lock each time it is started
+ */
+class reader_task : public emblib::rtos::task {
+public:
+    reader_task() : task("reader", 2, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        while (true) {
+            start.take();
+            volatile uint32_t sum = 0;
+            for (size_t i = 0; i < READ_COUNT; i++) {
+                if (use_shared) {
+                    std::shared_lock<emblib::rtos::shared_mutex> lock(table_shared_mutex);
+                    sum += read_table();
+                }
+                else {
+                    std::lock_guard<emblib::rtos::mutex> lock(table_mutex);
+                    sum += read_table();
+                }
+            }
+            done.give();
+        }
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+/**
+ * Occasionally writes the table, sleeping between writes
+ */
+class writer_task : public emblib::rtos::task {
+public:
+    writer_task() : task("writer", 2, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        while (true) {
+            start.take();
+            for (uint32_t i = 0; i < WRITE_COUNT; i++) {
+                if (use_shared) {
+                    std::lock_guard<emblib::rtos::shared_mutex> lock(table_shared_mutex);
+                    write_table(i);
+                }
+                else {
+                    std::lock_guard<emblib::rtos::mutex> lock(table_mutex);
+                    write_table(i);
+                }
+                sleep(emblib::rtos::ticks_t(0));
+            }
+            done.give();
+        }
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+/**
+ * Starts the readers and the writer for each lock and waits for all of them
+ */
+class controller_task : public emblib::rtos::task {
+public:
+    controller_task() : task("controller", 1, m_stack) {}
+
+private:
+    double measure(bool shared) noexcept
+    {
+        use_shared = shared;
+        const auto begin = clock_type::now();
+        for (size_t i = 0; i < READER_COUNT + 1; i++)
+            start.give();
+        for (size_t i = 0; i < READER_COUNT + 1; i++)
+            done.take();
+        const std::chrono::duration<double> elapsed = clock_type::now() - begin;
+        return READER_COUNT * READ_COUNT / elapsed.count();
+    }
+
+    void run() noexcept override
+    {
+        reads_per_second[0] = measure(false);
+        reads_per_second[1] = measure(true);
+        emblib::rtos::task::stop_tasks();
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+}
+
+TEST_CASE("Shared mutex contention benchmark", "[rtos][shared_mutex][benchmark][scheduler]")
+{
+    static reader_task readers[READER_COUNT];
+    static writer_task writer;
+    static controller_task controller;
+
+    emblib::rtos::task::start_tasks();
+
+    WARN("mutex:        " << reads_per_second[0] << " reads/s");
+    WARN("shared_mutex: " << reads_per_second[1] << " reads/s");
+    REQUIRE(reads_per_second[1] > 0);
+}
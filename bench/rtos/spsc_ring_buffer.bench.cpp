@@ -0,0 +1,71 @@
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/spsc_ring_buffer.hpp"
+#include "catch2/benchmark/catch_benchmark.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <thread>
+
+TEST_CASE("SPSC ring buffer benchmark", "[rtos][spsc_ring_buffer][benchmark]")
+{
+    using emblib::rtos::queue;
+    using emblib::rtos::spsc_ring_buffer;
+    using emblib::rtos::ticks_t;
+
+    constexpr size_t BURST_SIZE = 64;
+    constexpr size_t STREAM_SIZE = 1 << 16;
+
+    static queue<int16_t, BURST_SIZE> sample_queue;
+    static spsc_ring_buffer<int16_t, BURST_SIZE> sample_buffer;
+    int16_t samples[BURST_SIZE] = {0};
+
+    BENCHMARK("queue burst 64")
+    {
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            sample_queue.send(samples[i], ticks_t(0));
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            sample_queue.receive(samples[i], ticks_t(0));
+        return samples[BURST_SIZE - 1];
+    };
+
+    BENCHMARK("ring buffer burst 64 item by item")
+    {
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            sample_buffer.write(samples[i]);
+        for (size_t i = 0; i < BURST_SIZE; i++)
+            sample_buffer.read(samples[i]);
+        return samples[BURST_SIZE - 1];
+    };
+
+    BENCHMARK("ring buffer burst 64 bulk")
+    {
+        sample_buffer.write(samples, BURST_SIZE);
+        return sample_buffer.read(samples, BURST_SIZE);
+    };
+
+    /* Producer and consumer on separate host threads, FreeRTOS queue
+     * is not included since the POSIX port runs tasks on a single core */
+    BENCHMARK("ring buffer stream 65536 two threads")
+    {
+        std::thread producer([&samples] {
+            size_t written = 0;
+            while (written < STREAM_SIZE) {
+                const size_t count = sample_buffer.write(samples, std::min(BURST_SIZE / 4, STREAM_SIZE - written));
+                if (count == 0)
+                    std::this_thread::yield();
+                written += count;
+            }
+        });
+
+        int16_t received[BURST_SIZE];
+        size_t read = 0;
+        while (read < STREAM_SIZE) {
+            const size_t count = sample_buffer.read(received, BURST_SIZE);
+            if (count == 0)
+                std::this_thread::yield();
+            read += count;
+        }
+
+        producer.join();
+        return read;
+    };
+}
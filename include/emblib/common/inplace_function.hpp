@@ -0,0 +1,156 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <new>
+#include <type_traits>
+#include <utility>
+
+namespace emblib {
+
+template <typename signature_type, size_t CAPACITY = INPLACE_FUNCTION_CAPACITY>
+class inplace_function;
+
+/**
+ * Non-allocating replacement for `std::function`
+ *
+ * The callable is always stored inside the object in a buffer of
+ * `CAPACITY` bytes, and a callable which does not fit is a compile time
+ * error instead of a hidden heap allocation. Copying and calling never
+ * allocate, so it can be used for callbacks invoked from interrupts.
+ */
+template <typename return_type, typename... arg_types, size_t CAPACITY>
+class inplace_function<return_type(arg_types...), CAPACITY> {
+
+public:
+    inplace_function() noexcept = default;
+
+    inplace_function(std::nullptr_t) noexcept {}
+
+    template <
+        typename func_type,
+        typename = std::enable_if_t<!std::is_same_v<std::decay_t<func_type>, inplace_function>>
+    >
+    inplace_function(func_type&& func) noexcept
+    {
+        using stored_t = std::decay_t<func_type>;
+        static_assert(sizeof(stored_t) <= CAPACITY, "Callable captures too much, increase the inplace_function capacity");
+        static_assert(alignof(stored_t) <= alignof(std::max_align_t), "Callable is over-aligned");
+        static_assert(std::is_copy_constructible_v<stored_t>, "Callable must be copy constructible");
+        static_assert(std::is_invocable_r_v<return_type, stored_t&, arg_types...>, "Callable has wrong signature");
+
+        new (m_storage) stored_t(std::forward<func_type>(func));
+        m_invoke = &invoke<stored_t>;
+        m_manage = &manage<stored_t>;
+    }
+
+    inplace_function(const inplace_function& other) noexcept
+    {
+        copy_from(other, operation_e::COPY);
+    }
+
+    inplace_function(inplace_function&& other) noexcept
+    {
+        copy_from(other, operation_e::MOVE);
+    }
+
+    inplace_function& operator=(const inplace_function& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            copy_from(other, operation_e::COPY);
+        }
+        return *this;
+    }
+
+    inplace_function& operator=(inplace_function&& other) noexcept
+    {
+        if (this != &other) {
+            reset();
+            copy_from(other, operation_e::MOVE);
+        }
+        return *this;
+    }
+
+    ~inplace_function() noexcept
+    {
+        reset();
+    }
+
+    /**
+     * Call the stored callable
+     * @note Must not be empty
+     */
+    return_type operator()(arg_types... args) const
+    {
+        assert(m_invoke);
+        return m_invoke(m_storage, std::forward<arg_types>(args)...);
+    }
+
+    /**
+     * @returns `true` if a callable is stored
+     */
+    explicit operator bool() const noexcept
+    {
+        return m_invoke != nullptr;
+    }
+
+    /**
+     * Destroy the stored callable, leaving this empty
+     */
+    void reset() noexcept
+    {
+        if (m_manage) {
+            m_manage(m_storage, nullptr, operation_e::DESTROY);
+        }
+        m_invoke = nullptr;
+        m_manage = nullptr;
+    }
+
+private:
+    enum class operation_e {COPY, MOVE, DESTROY};
+
+    using invoke_t = return_type (*)(void*, arg_types&&...);
+    using manage_t = void (*)(void*, void*, operation_e);
+
+    template <typename stored_type>
+    static return_type invoke(void* storage, arg_types&&... args)
+    {
+        return (*static_cast<stored_type*>(storage))(std::forward<arg_types>(args)...);
+    }
+
+    /**
+     * Copy or move construct from `other` into `storage`, or destroy `storage`
+     */
+    template <typename stored_type>
+    static void manage(void* storage, void* other, operation_e operation) noexcept
+    {
+        switch (operation) {
+        case operation_e::COPY:
+            new (storage) stored_type(*static_cast<const stored_type*>(other));
+            break;
+        case operation_e::MOVE:
+            new (storage) stored_type(std::move(*static_cast<stored_type*>(other)));
+            break;
+        case operation_e::DESTROY:
+            static_cast<stored_type*>(storage)->~stored_type();
+            break;
+        }
+    }
+
+    void copy_from(const inplace_function& other, operation_e operation) noexcept
+    {
+        if (other.m_manage) {
+            other.m_manage(m_storage, other.m_storage, operation);
+        }
+        m_invoke = other.m_invoke;
+        m_manage = other.m_manage;
+    }
+
+private:
+    alignas(std::max_align_t) mutable unsigned char m_storage[CAPACITY];
+    invoke_t m_invoke = nullptr;
+    manage_t m_manage = nullptr;
+
+};
+
+}
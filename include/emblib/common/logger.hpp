@@ -62,6 +62,16 @@ public:
         m_format.precision(decimal_digits);
     }
 
+#if EMBLIB_RTOS_SUPPORT_MUTEX_STATS
+    /**
+     * Contention stats of the mutex guarding the log buffer
+     */
+    mutex::stats_s get_mutex_stats() const noexcept
+    {
+        return m_mutex.get_stats();
+    }
+#endif
+
 private:
     void log_item(const char* msg) noexcept
     {
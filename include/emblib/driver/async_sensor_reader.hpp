@@ -0,0 +1,252 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/common/inplace_function.hpp"
+#include "emblib/driver/char_dev.hpp"
+#include "emblib/driver/gpio_pin.hpp"
+#include "emblib/driver/three_axis_sensor.hpp"
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/monotonic_clock.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/spsc_ring_buffer.hpp"
+#include "emblib/rtos/task.hpp"
+#include <algorithm>
+#include <atomic>
+#include <utility>
+
+namespace emblib::driver {
+
+/**
+ * Interrupt driven sensor acquisition
+ *
+ * On each data ready interrupt the time is captured and an async transfer
+ * is started, which writes the data register address and reads the whole
+ * sample block of `BLOCK_SIZE` bytes. Completed blocks are pushed from the
+ * completion callback into a lock-free ring buffer, so no task runs per
+ * sample, and the consumer task sleeps in `wait_batch` until enough
+ * samples are buffered. Raw blocks are decoded by the consumer in `read`.
+ *
+ * @note The device must support async operations, for example an `i2c_dev`
+ * on a bus with DMA or interrupt driven transfers. Completion callbacks
+ * are expected to be called from an interrupt routine.
+ *
+ * @code
+ * driver::i2c_dev imu(i2c, 0x68);
+ * driver::async_sensor_reader<float, 6, 64> reader(imu, drdy_pin, ACCEL_XOUT_H, decode_accel);
+ * reader.set_batch_size(16);
+ * reader.start();
+ *
+ * // Consumer task
+ * decltype(reader)::sample_t samples[16];
+ * while (reader.wait_batch()) {
+ *     const size_t count = reader.read(samples, 16);
+ * }
+ * @endcode
+ */
+template <typename data_type, size_t BLOCK_SIZE, size_t CAPACITY>
+class async_sensor_reader {
+
+public:
+    using sample_t = typename three_axis_sensor<data_type>::sample_s;
+    using timestamp_t = typename three_axis_sensor<data_type>::timestamp_t;
+
+    /* Converts a raw block read from the sensor into axis data */
+    using decoder_t = inplace_function<bool(const char*, data_type (&)[3])>;
+
+    explicit async_sensor_reader(char_dev& device, gpio_pin& data_ready_pin, char data_register, decoder_t decoder) noexcept :
+        m_device(device),
+        m_data_ready_pin(data_ready_pin),
+        m_data_register(data_register),
+        m_decoder(std::move(decoder))
+    {}
+
+    /* Copy operations not allowed */
+    async_sensor_reader(const async_sensor_reader&) = delete;
+    async_sensor_reader& operator=(const async_sensor_reader&) = delete;
+
+    /* Move operations not allowed */
+    async_sensor_reader(async_sensor_reader&&) = delete;
+    async_sensor_reader& operator=(async_sensor_reader&&) = delete;
+
+    /**
+     * Enable the data ready interrupt
+     * @returns `false` if the device does not support async operations
+     * or the interrupt could not be set
+     */
+    bool start(gpio_pin::intr_e trigger = gpio_pin::intr_e::RISING) noexcept
+    {
+        if (!m_device.is_async_available()) {
+            return false;
+        }
+        return m_data_ready_pin.set_intr(trigger, [this] {on_data_ready();});
+    }
+
+    /**
+     * Disable the data ready interrupt
+     * @note Transfer in progress still completes and its sample is buffered
+     */
+    bool stop() noexcept
+    {
+        return m_data_ready_pin.set_intr(gpio_pin::intr_e::NONE, nullptr);
+    }
+
+    /**
+     * Set the number of buffered samples which wakes up `wait_batch`
+     * @note Clamped to the buffer capacity
+     */
+    void set_batch_size(size_t batch_size) noexcept
+    {
+        m_batch_size.store(std::clamp(batch_size, size_t(1), CAPACITY), std::memory_order_relaxed);
+    }
+
+    /**
+     * Wait up to `timeout` until at least a batch of samples is buffered
+     * @returns `false` on timeout
+     */
+    bool wait_batch(rtos::ticks_t timeout = rtos::MAX_TICKS) noexcept
+    {
+        const rtos::ticks_t start = rtos::task::get_tick_count();
+        while (m_blocks.get_size() < m_batch_size.load(std::memory_order_relaxed)) {
+            rtos::ticks_t remaining = timeout;
+            if (timeout != rtos::MAX_TICKS) {
+                const rtos::ticks_t elapsed = rtos::task::get_ticks_between(start, rtos::task::get_tick_count());
+                if (elapsed >= timeout) {
+                    return false;
+                }
+                remaining = timeout - elapsed;
+            }
+
+            /* Semaphore can be left given by an already consumed batch, so check again */
+            if (!m_batch_ready.take(remaining)) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * Decode up to `count` buffered samples, oldest first
+     * @returns Number of samples read
+     * @note Blocks which fail to decode are skipped and counted as errors
+     */
+    size_t read(sample_t* samples, size_t count) noexcept
+    {
+        size_t read_count = 0;
+        block_s block;
+        while (read_count < count && m_blocks.read(block)) {
+            if (!m_decoder(block.data, samples[read_count].data)) {
+                m_errors.fetch_add(1, std::memory_order_relaxed);
+                continue;
+            }
+            samples[read_count++].timestamp = block.timestamp;
+        }
+        return read_count;
+    }
+
+    /**
+     * Number of samples currently buffered
+     */
+    size_t get_size() const noexcept
+    {
+        return m_blocks.get_size();
+    }
+
+    /**
+     * Number of samples lost because a transfer was still in progress
+     * on data ready, or because the buffer was full
+     */
+    uint32_t get_overruns() const noexcept
+    {
+        return m_overruns.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Number of failed transfers and samples which failed to decode
+     */
+    uint32_t get_errors() const noexcept
+    {
+        return m_errors.load(std::memory_order_relaxed);
+    }
+
+private:
+    struct block_s {
+        char data[BLOCK_SIZE];
+        timestamp_t timestamp;
+    };
+
+    void on_data_ready() noexcept
+    {
+        if (m_is_busy.exchange(true, std::memory_order_acquire)) {
+            m_overruns.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+
+        m_block.timestamp = rtos::monotonic_clock::now();
+        const bool is_started = m_device.write_async(&m_data_register, 1, [this](ssize_t result) {
+            on_register_written(result);
+        });
+        if (!is_started) {
+            on_transfer_failed();
+        }
+    }
+
+    void on_register_written(ssize_t result) noexcept
+    {
+        const bool is_started = result == 1 && m_device.read_async(m_block.data, BLOCK_SIZE, [this](ssize_t read_result) {
+            on_block_read(read_result);
+        });
+        if (!is_started) {
+            on_transfer_failed();
+        }
+    }
+
+    void on_block_read(ssize_t result) noexcept
+    {
+        if (result != static_cast<ssize_t>(BLOCK_SIZE)) {
+            on_transfer_failed();
+            return;
+        }
+
+        if (!m_blocks.write_from_isr(m_block)) {
+            m_overruns.fetch_add(1, std::memory_order_relaxed);
+        }
+        m_is_busy.store(false, std::memory_order_release);
+
+        if (m_blocks.get_size() >= m_batch_size.load(std::memory_order_relaxed)) {
+            rtos::isr_context context;
+            m_batch_ready.give_from_isr(&context);
+        }
+    }
+
+    void on_transfer_failed() noexcept
+    {
+        m_errors.fetch_add(1, std::memory_order_relaxed);
+        m_is_busy.store(false, std::memory_order_release);
+    }
+
+private:
+    char_dev& m_device;
+    gpio_pin& m_data_ready_pin;
+    const char m_data_register;
+    decoder_t m_decoder;
+
+    /* Block being transferred, owned by the interrupt routines while busy */
+    block_s m_block;
+    std::atomic<bool> m_is_busy {false};
+
+    rtos::spsc_ring_buffer<block_s, CAPACITY> m_blocks;
+    rtos::semaphore m_batch_ready;
+    std::atomic<size_t> m_batch_size {1};
+
+    std::atomic<uint32_t> m_overruns {0};
+    std::atomic<uint32_t> m_errors {0};
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace driver;
+}
+#endif
@@ -1,14 +1,13 @@
 #pragma once
 
 #include "emblib/emblib.hpp"
+#include "emblib/common/inplace_function.hpp"
 #include "emblib/common/time.hpp"
 
 #if EMBLIB_CHAR_DEV_SUPPORT_ETL
 #include <etl/string.h>
 #endif
 
-#include <functional>
-
 namespace emblib::driver {
 
 /**
@@ -19,7 +18,7 @@ class char_dev {
 
 public:
     /* Typedef of callback functions for async operations */
-    using callback_t = std::function<void(ssize_t)>;
+    using callback_t = inplace_function<void(ssize_t)>;
 
     explicit char_dev() = default;
     virtual ~char_dev() = default;
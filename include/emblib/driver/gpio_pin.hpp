@@ -1,7 +1,7 @@
 #pragma once
 
 #include "emblib/emblib.hpp"
-#include <functional>
+#include "emblib/common/inplace_function.hpp"
 
 namespace emblib::driver {
 
@@ -12,6 +12,9 @@ public:
     enum class pull_e {NONE, UP, DOWN};
     enum class intr_e {NONE, RISING, FALLING, BOTH};
 
+    /* Typedef of the interrupt callback, called from the interrupt routine */
+    using intr_callback_t = inplace_function<void()>;
+
 public:
     explicit gpio_pin() = default;
     virtual ~gpio_pin() = default;
@@ -55,7 +58,7 @@ public:
     /**
      * Set the interrupt trigger type and the callback
      */
-    virtual bool set_intr(intr_e intr, std::function<void()>) noexcept = 0;
+    virtual bool set_intr(intr_e intr, intr_callback_t callback) noexcept = 0;
 
 };
 
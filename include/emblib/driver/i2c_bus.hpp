@@ -1,8 +1,8 @@
 #pragma once
 
 #include "emblib/emblib.hpp"
+#include "emblib/common/inplace_function.hpp"
 #include "emblib/common/time.hpp"
-#include <functional>
 
 namespace emblib::driver {
 
@@ -22,7 +22,7 @@ class i2c_bus {
 
 public:
     /* Private typedef for async operation callbacks */
-    using callback_t = std::function<void(ssize_t)>;
+    using callback_t = inplace_function<void(ssize_t)>;
 
     explicit i2c_bus() = default;
     virtual ~i2c_bus() = default;
@@ -40,14 +40,14 @@ public:
      * @returns `-1` if error, else number of bytes written
      * @note Exits once the write operation is complete
     */
-    virtual ssize_t write(i2c_address_t address, const char* data, size_t size, milliseconds timeout = MAX_MILLISECONDS) noexcept = 0;
+    virtual ssize_t write(i2c_address_t address, const char* data, size_t size, milliseconds timeout = milliseconds::max()) noexcept = 0;
 
     /**
      * Read up to `size` bytes into the buffer from the device with the specified address
      * @returns `-1` if error, else number of bytes read
      * @note Exits once the read operation is complete
     */
-    virtual ssize_t read(i2c_address_t address, char* buffer, size_t size, milliseconds timeout = MAX_MILLISECONDS) noexcept = 0;
+    virtual ssize_t read(i2c_address_t address, char* buffer, size_t size, milliseconds timeout = milliseconds::max()) noexcept = 0;
 
     /**
      * Start an async write
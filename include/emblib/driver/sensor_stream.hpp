@@ -0,0 +1,126 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/driver/three_axis_sensor.hpp"
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/monotonic_clock.hpp"
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/seqlock.hpp"
+#include <atomic>
+
+namespace emblib::driver {
+
+/**
+ * Timestamped sample stream from a three axis sensor to a consumer task
+ *
+ * Data ready time is captured in the interrupt, then the acquisition task
+ * reads the sample stamped with that time and sends it through a queue,
+ * so the consumer can compensate for the read and queueing delay, or
+ * align the samples of multiple sensors with `dsp::sample_aligner`.
+ *
+ * @code
+ * drdy_pin.set_intr(gpio_pin::intr_e::RISING, [&stream] {
+ *     rtos::isr_context context;
+ *     stream.capture_data_ready_from_isr(&context);
+ * });
+ *
+ * // Acquisition task
+ * while (true) {
+ *     stream.acquire(rtos::MAX_TICKS);
+ * }
+ *
+ * // Consumer task
+ * accelerometer::sample_s sample;
+ * stream.receive(sample);
+ * @endcode
+ */
+template <typename data_type, size_t CAPACITY>
+class sensor_stream {
+
+public:
+    using sensor_t = three_axis_sensor<data_type>;
+    using sample_t = typename sensor_t::sample_s;
+    using timestamp_t = typename sensor_t::timestamp_t;
+
+    explicit sensor_stream(sensor_t& sensor) noexcept :
+        m_sensor(sensor)
+    {}
+
+    /* Copy operations not allowed */
+    sensor_stream(const sensor_stream&) = delete;
+    sensor_stream& operator=(const sensor_stream&) = delete;
+
+    /* Move operations not allowed */
+    sensor_stream(sensor_stream&&) = delete;
+    sensor_stream& operator=(sensor_stream&&) = delete;
+
+    /**
+     * Capture the data ready time and wake up the acquisition task
+     * @note Call from the data ready interrupt routine
+     */
+    void capture_data_ready_from_isr(rtos::isr_context* context = nullptr) noexcept
+    {
+        m_data_ready_time.write(rtos::monotonic_clock::now());
+        m_data_ready.give_from_isr(context);
+    }
+
+    /**
+     * Wait up to `timeout` for data ready, then read the sample and send it to the queue
+     * @returns `false` on timeout, failed read or full queue
+     * @note Without a data ready interrupt, use a zero timeout to poll and
+     * the sample is stamped with the time of the read
+     */
+    bool acquire(rtos::ticks_t timeout = rtos::ticks_t(0)) noexcept
+    {
+        sample_t sample;
+        if (m_data_ready.take(timeout)) {
+            /* Task can't preempt the interrupt which writes the time */
+            if (!m_sensor.read_sample(sample, m_data_ready_time.read())) {
+                return false;
+            }
+        }
+        else if (timeout != rtos::ticks_t(0) || !m_sensor.is_data_available() || !m_sensor.read_sample(sample, rtos::monotonic_clock::now())) {
+            return false;
+        }
+
+        if (!m_samples.send(sample, rtos::ticks_t(0))) {
+            m_dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        }
+        return true;
+    }
+
+    /**
+     * Receive the oldest sample
+     * @returns `false` on timeout
+     */
+    bool receive(sample_t& sample, rtos::ticks_t timeout = rtos::MAX_TICKS) noexcept
+    {
+        return m_samples.receive(sample, timeout);
+    }
+
+    /**
+     * Number of samples dropped because the consumer fell behind
+     */
+    uint32_t get_dropped() const noexcept
+    {
+        return m_dropped.load(std::memory_order_relaxed);
+    }
+
+private:
+    sensor_t& m_sensor;
+    rtos::seqlock<timestamp_t> m_data_ready_time;
+    rtos::semaphore m_data_ready;
+    rtos::queue<sample_t, CAPACITY> m_samples;
+    std::atomic<uint32_t> m_dropped {0};
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace driver;
+}
+#endif
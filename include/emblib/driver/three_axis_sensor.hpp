@@ -1,6 +1,7 @@
 #pragma once
 
 #include "emblib/emblib.hpp"
+#include "emblib/rtos/timestamp.hpp"
 
 namespace emblib::driver {
 
@@ -13,6 +14,16 @@ public:
         X, Y, Z
     };
 
+    using timestamp_t = rtos::timestamp_t;
+
+    /**
+     * Reading of all axes with the time the data was sampled
+     */
+    struct sample_s {
+        data_type data[3];
+        timestamp_t timestamp;
+    };
+
 public:
     /**
      * Default constructor and destructor
@@ -52,6 +63,57 @@ public:
         return success;
     }
 
+    /**
+     * Read all axes into a sample with the given timestamp
+     * @param timestamp Time the data was sampled, ideally captured in the
+     * data ready interrupt, so that it does not include the bus and
+     * scheduling latency of the read
+     */
+    virtual bool read_sample(sample_s& out_sample, timestamp_t timestamp) noexcept
+    {
+        out_sample.timestamp = timestamp;
+        return read_all_axes(out_sample.data);
+    }
+
+    /**
+     * Read up to `count` samples from the sensor FIFO, oldest first
+     * @param newest Time the newest sample was taken, for example the
+     * time of the watermark interrupt
+     * @returns Number of samples read, `0` if none are available
+     * @note Default implementation is for sensors without a FIFO, which
+     * hold only the newest sample, so it reads at most one sample stamped
+     * with `newest`. Sensors with a FIFO should override it to read the
+     * whole FIFO in one bus transaction and use `set_fifo_timestamps` to
+     * stamp the samples based on the output data rate.
+     */
+    virtual size_t read_fifo(sample_s* out_samples, size_t count, timestamp_t newest) noexcept
+    {
+        if (count == 0 || !is_data_available() || !read_sample(out_samples[0], newest)) {
+            return 0;
+        }
+        return 1;
+    }
+
+    /**
+     * Set the number of samples in the FIFO at which the sensor signals
+     * data ready, so the FIFO can be read in batches
+     * @returns `false` if the sensor has no FIFO or the watermark is out of range
+     */
+    virtual bool set_fifo_watermark(size_t samples) noexcept
+    {
+        UNUSED(samples);
+        return false;
+    }
+
+    /**
+     * Number of samples in the FIFO at which the sensor signals data ready
+     * @note Sensors without a FIFO signal each sample
+     */
+    virtual size_t get_fifo_watermark() const noexcept
+    {
+        return 1;
+    }
+
     /**
      * Noise spectral density in units [data_type]/sqrt(Hz)
      */
@@ -60,6 +122,20 @@ public:
     /// @todo Add public static methods for bias estimation and sphere fitting
     /// @todo Add methods for setting the data rate and the sensitivity (range)
 
+protected:
+    /**
+     * Stamp samples read from the FIFO in a single transaction, going back
+     * from the newest one by the sampling period
+     * @param newest Time the newest sample was taken, for example the
+     * time of the watermark interrupt
+     */
+    static void set_fifo_timestamps(sample_s* samples, size_t count, timestamp_t newest, timestamp_t::duration period) noexcept
+    {
+        for (size_t i = 0; i < count; i++) {
+            samples[i].timestamp = newest - period * static_cast<int64_t>(count - 1 - i);
+        }
+    }
+
 };
 
 }
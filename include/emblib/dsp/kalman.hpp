@@ -9,8 +9,14 @@ namespace emblib::dsp {
 
 /**
  * Kalman filter
+ * @note `ACCUMULATE` sets the accumulation precision of the matrix products,
+ * refer to `math::accumulate_e`
  */
-template <size_t STATE_DIM, typename scalar_type = float>
+template <
+    size_t STATE_DIM,
+    typename scalar_type = float,
+    math::accumulate_e ACCUMULATE = math::accumulate_e::NATIVE
+>
 class kalman {
     template <size_t DIM>
     using vec_t = math::vector<scalar_type, DIM>;
@@ -89,9 +95,9 @@ private:
 };
 
 
-template <size_t STATE_DIM, typename scalar_type>
+template <size_t STATE_DIM, typename scalar_type, math::accumulate_e ACCUMULATE>
 template <size_t OBS_DIM>
-inline void kalman<STATE_DIM, scalar_type>::update(
+inline void kalman<STATE_DIM, scalar_type, ACCUMULATE>::update(
     std::function<vec_t<STATE_DIM>(const vec_t<STATE_DIM> &)> f,
     std::function<mat_t<STATE_DIM>(const vec_t<STATE_DIM> &)> F,
     std::function<vec_t<OBS_DIM>(const vec_t<STATE_DIM> &)> h,
@@ -103,22 +109,22 @@ inline void kalman<STATE_DIM, scalar_type>::update(
 {
     const auto state_predict = f(m_state);
     const auto Fj = F(m_state); // State jacobian
-    const mat_t<STATE_DIM> cov_predict = Fj.matmul(m_p).matmul(Fj.transpose()) + Q;
+    const mat_t<STATE_DIM> cov_predict = Fj.template matmul<ACCUMULATE>(m_p).template matmul<ACCUMULATE>(Fj.transpose()) + Q;
 
     const auto Hj = H(state_predict); // State to obs jacobian
     const auto HjT = Hj.transpose();
     const vec_t<OBS_DIM> obs_diff = observation - h(state_predict);
-    const mat_t<OBS_DIM> obs_cov = Hj.matmul(cov_predict).matmul(HjT) + R;
+    const mat_t<OBS_DIM> obs_cov = Hj.template matmul<ACCUMULATE>(cov_predict).template matmul<ACCUMULATE>(HjT) + R;
 
-    const mat_t<STATE_DIM, OBS_DIM> kalman_gain = cov_predict.matmul(HjT).matdivr(obs_cov);
+    const mat_t<STATE_DIM, OBS_DIM> kalman_gain = cov_predict.template matmul<ACCUMULATE>(HjT).matdivr(obs_cov);
 
-    m_state = state_predict + kalman_gain.matmul(obs_diff);
-    m_p = cov_predict - kalman_gain.matmul(Hj).matmul(cov_predict);
+    m_state = state_predict + kalman_gain.template matmul<ACCUMULATE>(obs_diff);
+    m_p = cov_predict - kalman_gain.template matmul<ACCUMULATE>(Hj).template matmul<ACCUMULATE>(cov_predict);
 }
 
-template <size_t STATE_DIM, typename scalar_type>
+template <size_t STATE_DIM, typename scalar_type, math::accumulate_e ACCUMULATE>
 template <size_t OBS_DIM>
-inline void kalman<STATE_DIM, scalar_type>::update(
+inline void kalman<STATE_DIM, scalar_type, ACCUMULATE>::update(
     const mat_t<STATE_DIM> &F,
     const vec_t<STATE_DIM> &u,
     const mat_t<OBS_DIM, STATE_DIM>& H,
@@ -127,16 +133,17 @@ inline void kalman<STATE_DIM, scalar_type>::update(
     const vec_t<OBS_DIM> &z
 ) noexcept
 {
-    auto f = [&F, &u](const vec_t<STATE_DIM>& state) {
-        return F.matmul(state) + u;
+    /* Explicit return types so the expressions are evaluated before temporaries are destroyed */
+    auto f = [&F, &u](const vec_t<STATE_DIM>& state) -> vec_t<STATE_DIM> {
+        return F.template matmul<ACCUMULATE>(state) + u;
     };
 
     auto Fj = [&F](const vec_t<STATE_DIM>& state) {
         return F;
     };
 
-    auto h = [&H](const vec_t<STATE_DIM>& state) {
-        return H.matmul(state);
+    auto h = [&H](const vec_t<STATE_DIM>& state) -> vec_t<OBS_DIM> {
+        return H.template matmul<ACCUMULATE>(state);
     };
 
     auto Hj = [&H](const vec_t<STATE_DIM>& state) {
@@ -0,0 +1,187 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/driver/three_axis_sensor.hpp"
+#include <algorithm>
+#include <chrono>
+
+namespace emblib::dsp {
+
+/**
+ * Aligns timestamped three axis samples of multiple streams
+ *
+ * Stream 0 is the reference, and every other stream is linearly
+ * interpolated at the timestamps of the reference samples. A reference
+ * sample is held back until all other streams have a sample at or after
+ * its timestamp, so the added latency is at most one sample period of the
+ * slowest stream, instead of the whole period of waiting for a new pair.
+ *
+ * Each other stream keeps its last `HISTORY_SIZE` samples, which must
+ * cover the time a reference sample waits. A stream which runs `N` times
+ * faster than the reference needs a history of at least `N + 1` samples,
+ * and reference samples older than the history take its oldest sample.
+ *
+ * @code
+ * dsp::sample_aligner<float, 2, 8> aligner;
+ * aligner.push(0, gyro_sample);
+ * aligner.push(1, accel_sample);
+ * while (aligner.pop(aligned)) {
+ *     filter.update(aligned.samples[0].data, aligned.samples[1].data);
+ * }
+ * @endcode
+ */
+template <typename data_type, size_t STREAM_COUNT, size_t CAPACITY, size_t HISTORY_SIZE = 4>
+class sample_aligner {
+
+    static_assert(STREAM_COUNT >= 2, "Need a reference and at least one other stream");
+    static_assert(CAPACITY > 0);
+    static_assert(HISTORY_SIZE >= 2, "Need at least two samples to interpolate");
+
+public:
+    using sample_t = typename driver::three_axis_sensor<data_type>::sample_s;
+    using timestamp_t = typename driver::three_axis_sensor<data_type>::timestamp_t;
+
+    /**
+     * Samples of all the streams at the timestamp of a reference sample
+     */
+    struct aligned_s {
+        sample_t samples[STREAM_COUNT];
+    };
+
+    explicit sample_aligner() = default;
+
+    /**
+     * Add a new sample of the stream
+     * @returns `false` if the stream index is invalid, or the reference
+     * sample buffer is full in which case the oldest one is dropped
+     * @note Samples of each stream must be pushed in time order
+     */
+    bool push(size_t stream, const sample_t& sample) noexcept
+    {
+        if (stream >= STREAM_COUNT) {
+            return false;
+        }
+        if (stream != 0) {
+            m_streams[stream].push(sample);
+            return true;
+        }
+
+        const bool is_full = m_pending_count == CAPACITY;
+        if (is_full) {
+            m_pending_head = (m_pending_head + 1) % CAPACITY;
+            m_pending_count--;
+        }
+        m_pending[(m_pending_head + m_pending_count) % CAPACITY] = sample;
+        m_pending_count++;
+        return !is_full;
+    }
+
+    /**
+     * Get the oldest reference sample together with the other streams interpolated at its time
+     * @returns `false` if no reference sample can be aligned yet
+     */
+    bool pop(aligned_s& aligned) noexcept
+    {
+        if (m_pending_count == 0) {
+            return false;
+        }
+
+        const sample_t& reference = m_pending[m_pending_head];
+        for (size_t i = 1; i < STREAM_COUNT; i++) {
+            if (m_streams[i].count == 0 || m_streams[i].get_newest().timestamp < reference.timestamp) {
+                return false;
+            }
+        }
+
+        aligned.samples[0] = reference;
+        for (size_t i = 1; i < STREAM_COUNT; i++) {
+            interpolate(m_streams[i], reference.timestamp, aligned.samples[i]);
+        }
+        m_pending_head = (m_pending_head + 1) % CAPACITY;
+        m_pending_count--;
+        return true;
+    }
+
+    /**
+     * Number of reference samples waiting for the other streams
+     */
+    size_t get_pending() const noexcept
+    {
+        return m_pending_count;
+    }
+
+private:
+    /**
+     * Ring buffer of the last samples of a stream, oldest first
+     */
+    struct stream_s {
+        sample_t samples[HISTORY_SIZE];
+        size_t head;
+        size_t count;
+
+        void push(const sample_t& sample) noexcept
+        {
+            samples[(head + count) % HISTORY_SIZE] = sample;
+            if (count < HISTORY_SIZE) {
+                count++;
+            }
+            else {
+                head = (head + 1) % HISTORY_SIZE;
+            }
+        }
+
+        const sample_t& get(size_t idx) const noexcept
+        {
+            return samples[(head + idx) % HISTORY_SIZE];
+        }
+
+        const sample_t& get_newest() const noexcept
+        {
+            return get(count - 1);
+        }
+    };
+
+    /**
+     * Interpolate between the two samples around the time, or take the
+     * oldest one if the time is before the whole history
+     * @note The newest sample must be at or after the time
+     */
+    static void interpolate(const stream_s& stream, timestamp_t time, sample_t& out) noexcept
+    {
+        out.timestamp = time;
+
+        size_t idx = 0;
+        while (stream.get(idx).timestamp < time) {
+            idx++;
+        }
+
+        const sample_t& next = stream.get(idx);
+        if (idx == 0 || next.timestamp == time) {
+            std::copy_n(next.data, 3, out.data);
+            return;
+        }
+
+        const sample_t& prev = stream.get(idx - 1);
+        using seconds_t = std::chrono::duration<float>;
+        const float fraction = seconds_t(time - prev.timestamp) / seconds_t(next.timestamp - prev.timestamp);
+        for (size_t i = 0; i < 3; i++) {
+            out.data[i] = static_cast<data_type>(prev.data[i] + (next.data[i] - prev.data[i]) * fraction);
+        }
+    }
+
+private:
+    stream_s m_streams[STREAM_COUNT] {};
+
+    sample_t m_pending[CAPACITY];
+    size_t m_pending_head = 0;
+    size_t m_pending_count = 0;
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace dsp;
+}
+#endif
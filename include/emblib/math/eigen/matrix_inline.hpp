@@ -190,18 +190,76 @@ inline void matrix<scalar_type, ROWS, COLS, base_type>::fill(scalar_type scalar)
 }
 
 template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
-template <size_t COLS_RHS, typename rhs_base>
+template <accumulate_e ACCUMULATE, size_t COLS_RHS, typename rhs_base>
 inline auto matrix<scalar_type, ROWS, COLS, base_type>::matmul(const matrix<scalar_type, COLS, COLS_RHS, rhs_base> &rhs) const noexcept
 {
-    auto res = m_base * rhs.get_base();
-    return matrix<scalar_type, ROWS, COLS_RHS, decltype(res)>(res);
+    if constexpr (ACCUMULATE == accumulate_e::DOUBLE) {
+        matrix_native_t<scalar_type, ROWS, COLS_RHS> res =
+            (m_base.template cast<double>() * rhs.get_base().template cast<double>()).template cast<scalar_type>();
+        return matrix<scalar_type, ROWS, COLS_RHS, decltype(res)>(res);
+    } else if constexpr (ACCUMULATE == accumulate_e::KAHAN) {
+        matrix_native_t<scalar_type, ROWS, COLS_RHS> res;
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS_RHS; c++) {
+                scalar_type sum = 0;
+                scalar_type compensation = 0;
+                for (size_t i = 0; i < COLS; i++) {
+                    const scalar_type term = m_base(r, i) * rhs.get_base()(i, c);
+                    const scalar_type next = sum + term;
+                    /* Recover the low-order bits lost from the smaller operand */
+                    if (std::abs(sum) >= std::abs(term))
+                        compensation += (sum - next) + term;
+                    else
+                        compensation += (term - next) + sum;
+                    sum = next;
+                }
+                res(r, c) = sum + compensation;
+            }
+        }
+        return matrix<scalar_type, ROWS, COLS_RHS, decltype(res)>(res);
+    } else {
+        auto res = m_base * rhs.get_base();
+        return matrix<scalar_type, ROWS, COLS_RHS, decltype(res)>(res);
+    }
 }
 
 template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
-template <typename divisor_base>
+inline auto matrix<scalar_type, ROWS, COLS, base_type>::inverse() const noexcept
+{
+    static_assert(ROWS == COLS);
+    matrix_native_t<scalar_type, ROWS, COLS> res;
+    if constexpr (ROWS <= CLOSED_FORM_MAX_DIM) {
+        /* Eigen uses cofactor expansion for fixed sizes up to 4x4 */
+        res = m_base.inverse();
+    } else {
+        res = m_base.partialPivLu().inverse();
+    }
+    return matrix_same_t<decltype(res)>(res);
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+inline scalar_type matrix<scalar_type, ROWS, COLS, base_type>::determinant() const noexcept
+{
+    static_assert(ROWS == COLS);
+    if constexpr (ROWS <= CLOSED_FORM_MAX_DIM) {
+        return m_base.determinant();
+    } else {
+        return m_base.partialPivLu().determinant();
+    }
+}
+
+template <typename scalar_type, size_t ROWS, size_t COLS, typename base_type>
+template <solver_e SOLVER, typename divisor_base>
 inline auto matrix<scalar_type, ROWS, COLS, base_type>::matdivl(const matrix<scalar_type, ROWS, ROWS, divisor_base> &divisor) const noexcept
 {
-    Eigen::Matrix<scalar_type, ROWS, COLS> res = divisor.get_base().colPivHouseholderQr().solve(m_base);
+    matrix_native_t<scalar_type, ROWS, COLS> res;
+    if constexpr (SOLVER == solver_e::QR) {
+        res = divisor.get_base().colPivHouseholderQr().solve(m_base);
+    } else if constexpr (ROWS <= CLOSED_FORM_MAX_DIM) {
+        res = divisor.get_base().inverse() * m_base;
+    } else {
+        res = divisor.get_base().partialPivLu().solve(m_base);
+    }
     return matrix_same_t<decltype(res)>(res);
 }
 
@@ -24,11 +24,38 @@ namespace emblib::math {
 #elif EMBLIB_MATH_USE_EIGEN
     template <typename scalar_type, size_t ROWS, size_t COLS = ROWS>
     using matrix_native_t = Eigen::Matrix<scalar_type, ROWS, COLS>;
+    template <typename scalar_type, size_t ROWS, size_t COLS = ROWS>
+    using matrix_native_view_t = Eigen::Map<const matrix_native_t<scalar_type, ROWS, COLS>>;
 #else
     #error "Matrix implementation not defined"
 #endif
 
 
+/**
+ * Precision used for accumulating the sums of products in `matmul` and `dot`
+ * @note `DOUBLE` accumulates in `double` and rounds the result to the
+ * scalar type, `KAHAN` keeps the scalar type but uses compensated
+ * (Kahan-Babuska) summation, which is not preserved under `-ffast-math`
+ */
+enum class accumulate_e {
+    NATIVE,
+    DOUBLE,
+    KAHAN
+};
+
+/**
+ * Method used for solving the linear system in `matdivl` and `matdivr`
+ * @note `QR` uses column pivoting, so a singular or ill-conditioned divisor
+ * gives a least-squares solution. `DIRECT` inverts the divisor in
+ * closed-form for sizes up to `CLOSED_FORM_MAX_DIM` and uses LU with
+ * partial pivoting above that, which is faster but gives inf or NaN
+ * for a singular divisor, so use it only for well-conditioned systems
+ */
+enum class solver_e {
+    QR,
+    DIRECT
+};
+
 /**
  * Matrix
  */
@@ -41,6 +68,12 @@ template <
 class matrix {
 
 public:
+    /**
+     * Largest square matrix size for which inverse, determinant
+     * and division are computed using closed-form expressions
+     */
+    static constexpr size_t CLOSED_FORM_MAX_DIM = 4;
+
     template <typename other_base>
     using matrix_same_t = matrix<scalar_type, ROWS, COLS, other_base>;
     template <typename other_scalar, typename other_base>
@@ -247,23 +280,38 @@ public:
 
     /**
      * Matrix multiplication
+     * @note Result is evaluated when `ACCUMULATE` is not `NATIVE`
      */
-    template <size_t COLS_RHS, typename rhs_base>
+    template <accumulate_e ACCUMULATE = accumulate_e::NATIVE, size_t COLS_RHS, typename rhs_base>
     auto matmul(const matrix<scalar_type, COLS, COLS_RHS, rhs_base>& rhs) const noexcept;
 
+    /**
+     * Matrix inverse
+     * @note Closed-form (cofactor) expressions are used for sizes up to
+     * `CLOSED_FORM_MAX_DIM`, and LU with partial pivoting for larger sizes
+     */
+    auto inverse() const noexcept;
+
+    /**
+     * Matrix determinant
+     * @note Closed-form for sizes up to `CLOSED_FORM_MAX_DIM`, else LU
+     */
+    scalar_type determinant() const noexcept;
+
     /**
      * Equivalent to multiplying this matrix from the left by the inverse of the divisor
+     * @note Refer to `solver_e` for the available methods
      */
-    template <typename divisor_base>
+    template <solver_e SOLVER = solver_e::QR, typename divisor_base>
     auto matdivl(const matrix<scalar_type, ROWS, ROWS, divisor_base>& divisor) const noexcept;
 
     /**
      * Equivalent to multiplying this matrix from the right by the inverse of the divisor
      */
-    template <typename divisor_base>
+    template <solver_e SOLVER = solver_e::QR, typename divisor_base>
     auto matdivr(const matrix<scalar_type, COLS, COLS, divisor_base>& divisor) const noexcept
     {
-        return matrix<scalar_type, ROWS, COLS>(transpose().matdivl(divisor.transpose()).transpose());
+        return matrix<scalar_type, ROWS, COLS>(transpose().template matdivl<SOLVER>(divisor.transpose()).transpose());
     }
 
     /**
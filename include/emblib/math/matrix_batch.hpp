@@ -0,0 +1,311 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "matrix.hpp"
+#include <cmath>
+#include <utility>
+
+namespace emblib::math {
+
+/**
+ * Batch of `BATCH_SIZE` independent matrices of the same shape
+ *
+ * Elements are stored interleaved (structure of arrays), so the same
+ * element of every matrix in the batch is contiguous in memory. All the
+ * operations iterate over the batch in the innermost loop which lets the
+ * compiler vectorize across the batch, unlike operations on a single
+ * small matrix where the vector width is usually larger than the matrix.
+ */
+template <typename scalar_type, size_t ROWS, size_t COLS, size_t BATCH_SIZE>
+class matrix_batch {
+
+public:
+    template <size_t OTHER_ROWS, size_t OTHER_COLS>
+    using matrix_batch_shaped_t = matrix_batch<scalar_type, OTHER_ROWS, OTHER_COLS, BATCH_SIZE>;
+
+    /**
+     * Initialize all the elements of all the matrices to `scalar`
+     */
+    explicit matrix_batch(scalar_type scalar = 0) noexcept
+    {
+        fill(scalar);
+    }
+
+    /**
+     * Number of matrices in the batch
+     */
+    static constexpr size_t get_batch_size() noexcept
+    {
+        return BATCH_SIZE;
+    }
+
+    /**
+     * Get element of the matrix with index `idx`
+     */
+    scalar_type operator()(size_t idx, size_t row, size_t col) const
+    {
+        return m_data[row][col][idx];
+    }
+
+    /**
+     * Get element of the matrix with index `idx`
+     */
+    scalar_type& operator()(size_t idx, size_t row, size_t col)
+    {
+        return m_data[row][col][idx];
+    }
+
+    /**
+     * Copy out the matrix with index `idx`
+     */
+    matrix<scalar_type, ROWS, COLS> get_matrix(size_t idx) const noexcept
+    {
+        matrix<scalar_type, ROWS, COLS> result {0};
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS; c++)
+                result(r, c) = m_data[r][c][idx];
+        }
+        return result;
+    }
+
+    /**
+     * Assign the matrix with index `idx`
+     */
+    template <typename other_base>
+    void set_matrix(size_t idx, const matrix<scalar_type, ROWS, COLS, other_base>& other) noexcept
+    {
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS; c++)
+                m_data[r][c][idx] = other(r, c);
+        }
+    }
+
+    /**
+     * Fill all elements with the same value
+     */
+    void fill(scalar_type scalar) noexcept
+    {
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS; c++) {
+                for (size_t k = 0; k < BATCH_SIZE; k++)
+                    m_data[r][c][k] = scalar;
+            }
+        }
+    }
+
+    /**
+     * Transpose each matrix
+     */
+    matrix_batch_shaped_t<COLS, ROWS> transpose() const noexcept
+    {
+        matrix_batch_shaped_t<COLS, ROWS> result;
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS; c++) {
+                for (size_t k = 0; k < BATCH_SIZE; k++)
+                    result.m_data[c][r][k] = m_data[r][c][k];
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Element-wise addition
+     */
+    matrix_batch operator+(const matrix_batch& rhs) const noexcept
+    {
+        matrix_batch result = *this;
+        result += rhs;
+        return result;
+    }
+
+    /**
+     * Element-wise subtraction
+     */
+    matrix_batch operator-(const matrix_batch& rhs) const noexcept
+    {
+        matrix_batch result = *this;
+        result -= rhs;
+        return result;
+    }
+
+    /**
+     * Element-wise multiplication
+     */
+    matrix_batch operator*(const matrix_batch& rhs) const noexcept
+    {
+        matrix_batch result = *this;
+        result *= rhs;
+        return result;
+    }
+
+    /**
+     * Element-wise multiplication with a scalar
+     */
+    matrix_batch operator*(const scalar_type& rhs) const noexcept
+    {
+        matrix_batch result = *this;
+        result *= rhs;
+        return result;
+    }
+
+    /**
+     * Element-wise addition in-place
+     */
+    matrix_batch& operator+=(const matrix_batch& rhs) noexcept
+    {
+        for_each_element(rhs, [](scalar_type& lhs, scalar_type rhs) {lhs += rhs;});
+        return *this;
+    }
+
+    /**
+     * Element-wise subtraction in-place
+     */
+    matrix_batch& operator-=(const matrix_batch& rhs) noexcept
+    {
+        for_each_element(rhs, [](scalar_type& lhs, scalar_type rhs) {lhs -= rhs;});
+        return *this;
+    }
+
+    /**
+     * Element-wise multiplication in-place
+     */
+    matrix_batch& operator*=(const matrix_batch& rhs) noexcept
+    {
+        for_each_element(rhs, [](scalar_type& lhs, scalar_type rhs) {lhs *= rhs;});
+        return *this;
+    }
+
+    /**
+     * Element-wise in-place multiplication with a scalar
+     */
+    matrix_batch& operator*=(const scalar_type& rhs) noexcept
+    {
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS; c++) {
+                for (size_t k = 0; k < BATCH_SIZE; k++)
+                    m_data[r][c][k] *= rhs;
+            }
+        }
+        return *this;
+    }
+
+    /**
+     * Matrix multiplication of each pair of matrices
+     */
+    template <size_t COLS_RHS>
+    matrix_batch_shaped_t<ROWS, COLS_RHS> matmul(const matrix_batch_shaped_t<COLS, COLS_RHS>& rhs) const noexcept
+    {
+        matrix_batch_shaped_t<ROWS, COLS_RHS> result {0};
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS_RHS; c++) {
+                for (size_t i = 0; i < COLS; i++) {
+                    for (size_t k = 0; k < BATCH_SIZE; k++)
+                        result.m_data[r][c][k] += m_data[r][i][k] * rhs.m_data[i][c][k];
+                }
+            }
+        }
+        return result;
+    }
+
+    /**
+     * Equivalent to multiplying each matrix from the left by the inverse of the divisor
+     * @note Gauss-Jordan elimination with partial pivoting, where only the row swaps
+     * are done per matrix and the elimination is done across the whole batch
+     */
+    matrix_batch matdivl(const matrix_batch_shaped_t<ROWS, ROWS>& divisor) const noexcept
+    {
+        matrix_batch_shaped_t<ROWS, ROWS> lhs = divisor;
+        matrix_batch result = *this;
+
+        for (size_t p = 0; p < ROWS; p++) {
+            /* Find the pivot row for each matrix */
+            size_t pivot_row[BATCH_SIZE];
+            scalar_type pivot_abs[BATCH_SIZE];
+            for (size_t k = 0; k < BATCH_SIZE; k++) {
+                pivot_row[k] = p;
+                pivot_abs[k] = std::abs(lhs.m_data[p][p][k]);
+            }
+            for (size_t r = p + 1; r < ROWS; r++) {
+                for (size_t k = 0; k < BATCH_SIZE; k++) {
+                    const scalar_type elem_abs = std::abs(lhs.m_data[r][p][k]);
+                    const bool is_larger = elem_abs > pivot_abs[k];
+                    pivot_row[k] = is_larger ? r : pivot_row[k];
+                    pivot_abs[k] = is_larger ? elem_abs : pivot_abs[k];
+                }
+            }
+
+            /* Swap rows only for matrices which need it */
+            for (size_t k = 0; k < BATCH_SIZE; k++) {
+                if (pivot_row[k] == p)
+                    continue;
+                for (size_t c = p; c < ROWS; c++)
+                    std::swap(lhs.m_data[p][c][k], lhs.m_data[pivot_row[k]][c][k]);
+                for (size_t c = 0; c < COLS; c++)
+                    std::swap(result.m_data[p][c][k], result.m_data[pivot_row[k]][c][k]);
+            }
+
+            /* Normalize the pivot row */
+            scalar_type pivot_inv[BATCH_SIZE];
+            for (size_t k = 0; k < BATCH_SIZE; k++)
+                pivot_inv[k] = scalar_type(1) / lhs.m_data[p][p][k];
+            for (size_t c = p; c < ROWS; c++) {
+                for (size_t k = 0; k < BATCH_SIZE; k++)
+                    lhs.m_data[p][c][k] *= pivot_inv[k];
+            }
+            for (size_t c = 0; c < COLS; c++) {
+                for (size_t k = 0; k < BATCH_SIZE; k++)
+                    result.m_data[p][c][k] *= pivot_inv[k];
+            }
+
+            /* Eliminate the pivot column from all the other rows */
+            for (size_t r = 0; r < ROWS; r++) {
+                if (r == p)
+                    continue;
+                scalar_type factor[BATCH_SIZE];
+                for (size_t k = 0; k < BATCH_SIZE; k++)
+                    factor[k] = lhs.m_data[r][p][k];
+                for (size_t c = p; c < ROWS; c++) {
+                    for (size_t k = 0; k < BATCH_SIZE; k++)
+                        lhs.m_data[r][c][k] -= factor[k] * lhs.m_data[p][c][k];
+                }
+                for (size_t c = 0; c < COLS; c++) {
+                    for (size_t k = 0; k < BATCH_SIZE; k++)
+                        result.m_data[r][c][k] -= factor[k] * result.m_data[p][c][k];
+                }
+            }
+        }
+        return result;
+    }
+
+private:
+    template <typename func_type>
+    void for_each_element(const matrix_batch& rhs, func_type func) noexcept
+    {
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS; c++) {
+                for (size_t k = 0; k < BATCH_SIZE; k++)
+                    func(m_data[r][c][k], rhs.m_data[r][c][k]);
+            }
+        }
+    }
+
+    template <typename, size_t, size_t, size_t>
+    friend class matrix_batch;
+
+private:
+    scalar_type m_data[ROWS][COLS][BATCH_SIZE];
+};
+
+/**
+ * Convinience typedef for floating point matrix batches
+ */
+template <size_t ROWS, size_t COLS, size_t BATCH_SIZE>
+using matrixf_batch = matrix_batch<float, ROWS, COLS, BATCH_SIZE>;
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace math;
+}
+#endif
@@ -0,0 +1,129 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "matrix.hpp"
+#include "vector.hpp"
+
+namespace emblib::math {
+
+/**
+ * Constant matrix which can be created in a `constexpr` context
+ *
+ * Elements are stored in a plain array in the column-major order, so
+ * a `static constexpr` instance is placed in read-only memory and no
+ * static constructor is generated. Use `get_matrix` to get a matrix
+ * which refers to these elements without copying them.
+ */
+template <typename scalar_type, size_t ROWS, size_t COLS = ROWS>
+class matrix_literal {
+
+public:
+    using matrix_view_t = matrix<scalar_type, ROWS, COLS, matrix_native_view_t<scalar_type, ROWS, COLS>>;
+
+    /**
+     * Initialize all the elements of the matrix to `scalar`
+     */
+    constexpr explicit matrix_literal(scalar_type scalar = 0) noexcept
+    {
+        for (size_t c = 0; c < COLS; c++) {
+            for (size_t r = 0; r < ROWS; r++)
+                m_elements[c][r] = scalar;
+        }
+    }
+
+    /**
+     * Initialize the matrix with the elements given row by row
+     */
+    constexpr matrix_literal(const scalar_type (&elements)[ROWS][COLS]) noexcept
+    {
+        for (size_t r = 0; r < ROWS; r++) {
+            for (size_t c = 0; c < COLS; c++)
+                m_elements[c][r] = elements[r][c];
+        }
+    }
+
+    /**
+     * Get element
+     */
+    constexpr scalar_type operator()(size_t row, size_t col) const
+    {
+        return m_elements[col][row];
+    }
+
+    /**
+     * Get a matrix which refers to the elements of this literal
+     * @note Returned matrix must not outlive this object
+     */
+    matrix_view_t get_matrix() const noexcept
+    {
+        return matrix_view_t(matrix_native_view_t<scalar_type, ROWS, COLS>(&m_elements[0][0]));
+    }
+
+    /**
+     * Diagonal matrix
+     */
+    static constexpr matrix_literal diagonal(scalar_type diag_elem = 1) noexcept
+    {
+        static_assert(ROWS == COLS);
+        matrix_literal result {0};
+        for (size_t i = 0; i < ROWS; i++)
+            result.m_elements[i][i] = diag_elem;
+        return result;
+    }
+
+protected:
+    scalar_type m_elements[COLS][ROWS] {};
+};
+
+/**
+ * Constant vector which can be created in a `constexpr` context
+ */
+template <typename scalar_type, size_t DIM>
+class vector_literal : public matrix_literal<scalar_type, DIM, 1> {
+
+public:
+    using vector_view_t = vector<scalar_type, DIM, matrix_native_view_t<scalar_type, DIM, 1>>;
+
+    constexpr explicit vector_literal(scalar_type scalar = 0) noexcept :
+        matrix_literal<scalar_type, DIM, 1>(scalar) {}
+
+    constexpr vector_literal(const scalar_type (&elements)[DIM]) noexcept
+    {
+        for (size_t i = 0; i < DIM; i++)
+            this->m_elements[0][i] = elements[i];
+    }
+
+    /**
+     * Get element
+     */
+    constexpr scalar_type operator()(size_t idx) const
+    {
+        return this->m_elements[0][idx];
+    }
+
+    /**
+     * Get a vector which refers to the elements of this literal
+     * @note Returned vector must not outlive this object
+     */
+    vector_view_t get_vector() const noexcept
+    {
+        return vector_view_t(this->get_matrix());
+    }
+};
+
+/**
+ * Convinience typedefs for floating point literals
+ */
+template <size_t ROWS, size_t COLS = ROWS>
+using matrixf_literal = matrix_literal<float, ROWS, COLS>;
+
+template <size_t DIM>
+using vectorf_literal = vector_literal<float, DIM>;
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace math;
+}
+#endif
@@ -9,13 +9,13 @@ template <typename scalar_type>
 class quaternion {
 
 public:
-    quaternion(scalar_type w, scalar_type x, scalar_type y, scalar_type z) noexcept :
+    constexpr quaternion(scalar_type w, scalar_type x, scalar_type y, scalar_type z) noexcept :
         m_w(w), m_x(x), m_y(y), m_z(z) {}
 
     quaternion(scalar_type real, const vector<scalar_type, 3>& imag) noexcept :
         m_w(real), m_x(imag(0)), m_y(imag(1)), m_z(imag(2)) {}
 
-    scalar_type get_real() const noexcept
+    constexpr scalar_type get_real() const noexcept
     {
         return m_w;
     }
@@ -25,22 +25,22 @@ public:
         return {m_x, m_y, m_z};
     }
 
-    quaternion conjugate() const noexcept
+    constexpr quaternion conjugate() const noexcept
     {
         return {m_w, -m_x, -m_y, -m_z};
     }
 
-    quaternion operator+(const quaternion& rhs) const noexcept
+    constexpr quaternion operator+(const quaternion& rhs) const noexcept
     {
         return {m_w + rhs.m_w, m_x + rhs.m_x, m_y + rhs.m_y, m_z + rhs.m_z};
     }
 
-    quaternion operator*(const scalar_type& s) const noexcept
+    constexpr quaternion operator*(const scalar_type& s) const noexcept
     {
         return {m_w * s, m_x * s, m_y * s, m_z * s};
     }
 
-    quaternion operator*(const quaternion& rhs) const noexcept
+    constexpr quaternion operator*(const quaternion& rhs) const noexcept
     {
         return {
             m_w * rhs.m_w - m_x * rhs.m_x - m_y * rhs.m_y - m_z * rhs.m_z,
@@ -65,7 +65,7 @@ private:
 };
 
 template <typename scalar_type>
-quaternion<scalar_type> operator*(const scalar_type& lhs, const quaternion<scalar_type>& rhs) noexcept
+constexpr quaternion<scalar_type> operator*(const scalar_type& lhs, const quaternion<scalar_type>& rhs) noexcept
 {
     return rhs * lhs;
 }
@@ -52,11 +52,12 @@ public:
 
     /**
      * Dot product
+     * @note Refer to `accumulate_e` for the accumulation precision
      */
-    template <typename rhs_base>
+    template <accumulate_e ACCUMULATE = accumulate_e::NATIVE, typename rhs_base>
     scalar_type dot(const vector_same_t<rhs_base>& rhs) const noexcept
     {
-        const auto res = this->transpose().matmul(rhs);
+        const auto res = this->transpose().template matmul<ACCUMULATE>(rhs);
         return res(0, 0);
     }
 
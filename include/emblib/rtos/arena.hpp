@@ -0,0 +1,102 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace emblib::rtos {
+
+/**
+ * Statically allocated monotonic arena of `SIZE_BYTES`
+ *
+ * Memory is handed out by bumping an offset and is never given back
+ * individually, which suits objects created once during initialization
+ * and kept for the lifetime of the program. Allocation is lock-free,
+ * so it can be done from multiple tasks at the same time.
+ */
+template <size_t SIZE_BYTES>
+class arena {
+
+public:
+    explicit arena() = default;
+
+    /* Copy operations not allowed */
+    arena(const arena&) = delete;
+    arena& operator=(const arena&) = delete;
+
+    /* Move operations not allowed */
+    arena(arena&&) = delete;
+    arena& operator=(arena&&) = delete;
+
+    /**
+     * Allocate `size` bytes aligned to `alignment`
+     * @returns Pointer to uninitialized memory or `nullptr` if there is not enough space left
+     */
+    void* allocate(size_t size, size_t alignment = alignof(std::max_align_t)) noexcept
+    {
+        size_t offset = m_offset.load(std::memory_order_relaxed);
+        size_t start;
+        do {
+            const uintptr_t address = reinterpret_cast<uintptr_t>(m_storage) + offset;
+            start = offset + ((alignment - address % alignment) % alignment);
+            if (start + size > SIZE_BYTES) {
+                return nullptr;
+            }
+        } while (!m_offset.compare_exchange_weak(offset, start + size, std::memory_order_relaxed));
+
+        return m_storage + start;
+    }
+
+    /**
+     * Allocate and construct an object
+     * @returns `nullptr` if there is not enough space left
+     * @note Destructor of the object is never called
+     */
+    template <typename item_type, typename... arg_types>
+    item_type* create(arg_types&&... args) noexcept
+    {
+        void* memory = allocate(sizeof(item_type), alignof(item_type));
+        return memory ? new (memory) item_type(std::forward<arg_types>(args)...) : nullptr;
+    }
+
+    /**
+     * Release all the memory at once
+     * @note Objects created in the arena must not be used after this
+     */
+    void reset() noexcept
+    {
+        m_offset.store(0, std::memory_order_relaxed);
+    }
+
+    /**
+     * Number of bytes in the arena
+     */
+    static constexpr size_t get_capacity() noexcept
+    {
+        return SIZE_BYTES;
+    }
+
+    /**
+     * Number of bytes used, including alignment padding
+     */
+    size_t get_used() const noexcept
+    {
+        return m_offset.load(std::memory_order_relaxed);
+    }
+
+private:
+    alignas(std::max_align_t) uint8_t m_storage[SIZE_BYTES];
+    std::atomic<size_t> m_offset {0};
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,473 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+
+/* Coroutines need C++20, the header is empty for older standards */
+#if __cpp_impl_coroutine >= 201902L
+
+#include "emblib/common/inplace_function.hpp"
+#include "emblib/driver/char_dev.hpp"
+#include "emblib/driver/i2c_bus.hpp"
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/pool.hpp"
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/task.hpp"
+#include <algorithm>
+#include <coroutine>
+#include <exception>
+#include <utility>
+
+namespace emblib::rtos {
+
+class coroutine_scheduler;
+
+/**
+ * Lightweight cooperative task, run by a `coroutine_scheduler`
+ *
+ * Any function returning `coroutine` which uses `co_await` is a coroutine.
+ * Its frame (arguments and locals which live across `co_await`) is taken
+ * from a static pool of `COROUTINE_FRAME_COUNT` frames, each
+ * `COROUTINE_FRAME_SIZE` bytes. If the pool is exhausted or the frame is
+ * too large, the returned coroutine is empty and can't be spawned.
+ *
+ * @code
+ * rtos::coroutine blink(driver::gpio_pin& led)
+ * {
+ *     while (true) {
+ *         led.toggle();
+ *         co_await rtos::async_sleep(rtos::ticks_t(500));
+ *     }
+ * }
+ *
+ * scheduler.spawn(blink(led));
+ * @endcode
+ */
+class coroutine {
+
+public:
+    class promise_type {
+
+    public:
+        coroutine get_return_object() noexcept
+        {
+            return coroutine(std::coroutine_handle<promise_type>::from_promise(*this));
+        }
+
+        static coroutine get_return_object_on_allocation_failure() noexcept
+        {
+            return coroutine(nullptr);
+        }
+
+        /* Coroutine does not start until spawned, and frees its frame when done */
+        std::suspend_always initial_suspend() const noexcept
+        {
+            return {};
+        }
+
+        std::suspend_never final_suspend() const noexcept
+        {
+            return {};
+        }
+
+        void return_void() const noexcept {}
+
+        void unhandled_exception() const noexcept
+        {
+            std::terminate();
+        }
+
+        static void* operator new(size_t size) noexcept
+        {
+            return size <= sizeof(frame_s) ? s_frame_pool.allocate() : nullptr;
+        }
+
+        static void operator delete(void* frame) noexcept
+        {
+            s_frame_pool.free(frame);
+        }
+
+    private:
+        friend class coroutine_scheduler;
+        friend class wait_awaiter;
+        friend class async_op_awaiter;
+
+        coroutine_scheduler* m_scheduler = nullptr;
+
+        /* State while waiting in the scheduler */
+        promise_type* m_next_waiting = nullptr;
+        inplace_function<bool ()> m_poll;
+        ticks_t m_wait_start = ticks_t(0);
+        ticks_t m_timeout = MAX_TICKS;
+        bool m_timed_out = false;
+    };
+
+    using handle_t = std::coroutine_handle<promise_type>;
+
+    coroutine(coroutine&& other) noexcept :
+        m_handle(std::exchange(other.m_handle, nullptr))
+    {}
+
+    /* Copy operations not allowed */
+    coroutine(const coroutine&) = delete;
+    coroutine& operator=(const coroutine&) = delete;
+
+    coroutine& operator=(coroutine&&) = delete;
+
+    /**
+     * Frees the frame if the coroutine was never spawned
+     */
+    ~coroutine() noexcept
+    {
+        if (m_handle) {
+            m_handle.destroy();
+        }
+    }
+
+    /**
+     * @returns `false` if the frame could not be allocated
+     */
+    explicit operator bool() const noexcept
+    {
+        return static_cast<bool>(m_handle);
+    }
+
+    /**
+     * Number of frames currently allocated from the frame pool
+     */
+    static size_t get_frames_used() noexcept
+    {
+        return s_frame_pool.get_used();
+    }
+
+private:
+    friend class coroutine_scheduler;
+
+    explicit coroutine(handle_t handle) noexcept :
+        m_handle(handle)
+    {}
+
+    struct frame_s {
+        alignas(std::max_align_t) uint8_t data[COROUTINE_FRAME_SIZE];
+    };
+
+    static pool<frame_s, COROUTINE_FRAME_COUNT> s_frame_pool;
+
+private:
+    handle_t m_handle;
+
+};
+
+inline pool<coroutine::frame_s, COROUTINE_FRAME_COUNT> coroutine::s_frame_pool;
+
+/**
+ * Runs coroutines on the task which calls `run`
+ *
+ * Ready coroutines are resumed one after another, each running until its
+ * next `co_await`. Coroutines waiting on a queue or a semaphore are
+ * polled each time the scheduler wakes up, and at least once per tick
+ * while any are waiting, so they resume with up to a tick of latency.
+ */
+class coroutine_scheduler {
+
+public:
+    explicit coroutine_scheduler() = default;
+
+    /* Copy operations not allowed */
+    coroutine_scheduler(const coroutine_scheduler&) = delete;
+    coroutine_scheduler& operator=(const coroutine_scheduler&) = delete;
+
+    /* Move operations not allowed */
+    coroutine_scheduler(coroutine_scheduler&&) = delete;
+    coroutine_scheduler& operator=(coroutine_scheduler&&) = delete;
+
+    /**
+     * Start running the coroutine on this scheduler
+     * @returns `false` if the coroutine is empty
+     */
+    bool spawn(coroutine&& coroutine) noexcept
+    {
+        if (!coroutine) {
+            return false;
+        }
+        coroutine.m_handle.promise().m_scheduler = this;
+        schedule(std::exchange(coroutine.m_handle, nullptr));
+        return true;
+    }
+
+    /**
+     * Run the coroutines forever
+     * @note Call from the `run` method of the task which owns this scheduler
+     */
+    void run() noexcept
+    {
+        while (true) {
+            run_once(MAX_TICKS);
+        }
+    }
+
+    /**
+     * Wait up to `timeout` for any coroutine to become ready and run all ready ones
+     */
+    void run_once(ticks_t timeout) noexcept
+    {
+        std::coroutine_handle<> handle;
+        if (m_ready.receive(handle, get_wait_timeout(timeout))) {
+            do {
+                handle.resume();
+            } while (m_ready.receive(handle, ticks_t(0)));
+        }
+        poll_waiting();
+    }
+
+    /**
+     * Resume a suspended coroutine on the scheduler task
+     * @note Never blocks since there is space for every frame in the ready queue
+     */
+    void schedule(std::coroutine_handle<> handle) noexcept
+    {
+        m_ready.send(handle, ticks_t(0));
+    }
+
+    /**
+     * Resume a suspended coroutine from an interrupt routine
+     */
+    void schedule_from_isr(std::coroutine_handle<> handle, isr_context* context = nullptr) noexcept
+    {
+        m_ready.send_from_isr(handle, context);
+    }
+
+private:
+    friend class wait_awaiter;
+
+    void add_waiting(coroutine::promise_type& promise) noexcept
+    {
+        promise.m_next_waiting = m_waiting;
+        m_waiting = &promise;
+    }
+
+    /**
+     * Time until the earliest deadline, or a single tick if any coroutine needs polling
+     */
+    ticks_t get_wait_timeout(ticks_t timeout) const noexcept
+    {
+        const ticks_t now = task::get_tick_count();
+        for (const coroutine::promise_type* promise = m_waiting; promise; promise = promise->m_next_waiting) {
+            if (promise->m_poll) {
+                return timeout == MAX_TICKS ? ticks_t(1) : std::min(timeout, ticks_t(1));
+            }
+            if (promise->m_timeout != MAX_TICKS) {
+                const ticks_t elapsed = task::get_ticks_between(promise->m_wait_start, now);
+                const ticks_t remaining = elapsed < promise->m_timeout ? promise->m_timeout - elapsed : ticks_t(0);
+                timeout = timeout == MAX_TICKS ? remaining : std::min(timeout, remaining);
+            }
+        }
+        return timeout;
+    }
+
+    /**
+     * Resume the waiting coroutines which got their data or timed out
+     * @note List is detached before walking it, since a resumed coroutine can
+     * wait again, and it is then polled on the next wake up instead of here
+     */
+    void poll_waiting() noexcept
+    {
+        const ticks_t now = task::get_tick_count();
+        coroutine::promise_type* promise = std::exchange(m_waiting, nullptr);
+        while (promise) {
+            coroutine::promise_type* next = promise->m_next_waiting;
+            const bool is_ready = promise->m_poll && promise->m_poll();
+            const bool is_expired = !is_ready && promise->m_timeout != MAX_TICKS &&
+                task::get_ticks_between(promise->m_wait_start, now) >= promise->m_timeout;
+            if (is_ready || is_expired) {
+                promise->m_timed_out = is_expired;
+                promise->m_poll.reset();
+                coroutine::handle_t::from_promise(*promise).resume();
+            }
+            else {
+                add_waiting(*promise);
+            }
+            promise = next;
+        }
+    }
+
+private:
+    queue<std::coroutine_handle<>, COROUTINE_FRAME_COUNT> m_ready;
+    coroutine::promise_type* m_waiting = nullptr;
+
+};
+
+/**
+ * Awaitable which suspends until `poll` returns `true` or the timeout passes
+ */
+class wait_awaiter {
+
+public:
+    explicit wait_awaiter(inplace_function<bool ()> poll, ticks_t timeout) noexcept :
+        m_poll(std::move(poll)),
+        m_timeout(timeout)
+    {}
+
+    bool await_ready() noexcept
+    {
+        m_is_done = m_poll && m_poll();
+        return m_is_done;
+    }
+
+    void await_suspend(coroutine::handle_t handle) noexcept
+    {
+        coroutine::promise_type& promise = handle.promise();
+        promise.m_poll = std::move(m_poll);
+        /* Elapsed time is compared instead of an absolute deadline, which
+         * would be wrong once the tick count wraps around */
+        promise.m_wait_start = task::get_tick_count();
+        promise.m_timeout = m_timeout;
+        promise.m_scheduler->add_waiting(promise);
+        m_handle = handle;
+    }
+
+    /**
+     * @returns `false` on timeout
+     */
+    bool await_resume() const noexcept
+    {
+        return m_is_done || !m_handle.promise().m_timed_out;
+    }
+
+private:
+    inplace_function<bool ()> m_poll;
+    ticks_t m_timeout;
+    coroutine::handle_t m_handle;
+    bool m_is_done = false;
+
+};
+
+/**
+ * Awaitable which starts an async operation and suspends
+ * until its completion callback is called
+ * @note Completion callbacks are expected to be called from an interrupt routine
+ */
+class async_op_awaiter {
+
+public:
+    /* Same as the char device and I2C bus completion callbacks */
+    using callback_t = inplace_function<void (ssize_t)>;
+
+    /* Starts the operation with the given callback, returns `false` if it did not start */
+    using start_t = inplace_function<bool (const callback_t&)>;
+
+    explicit async_op_awaiter(start_t start) noexcept :
+        m_start(std::move(start))
+    {}
+
+    bool await_ready() const noexcept
+    {
+        return false;
+    }
+
+    bool await_suspend(coroutine::handle_t handle) noexcept
+    {
+        coroutine_scheduler* scheduler = handle.promise().m_scheduler;
+        const bool is_started = m_start([this, scheduler, handle](ssize_t result) {
+            m_result = result;
+            scheduler->schedule_from_isr(handle);
+        });
+
+        /* Resume immediately if the operation could not be started */
+        return is_started;
+    }
+
+    /**
+     * @returns Result passed to the completion callback, `-1` if the operation did not start
+     */
+    ssize_t await_resume() const noexcept
+    {
+        return m_result;
+    }
+
+private:
+    start_t m_start;
+    ssize_t m_result = -1;
+
+};
+
+/**
+ * Suspend the coroutine for `duration`
+ */
+inline wait_awaiter async_sleep(ticks_t duration) noexcept
+{
+    return wait_awaiter(nullptr, duration);
+}
+
+/**
+ * Receive an item from the queue without blocking the scheduler task
+ * @returns Awaitable which results in `false` on timeout
+ */
+template <typename item_type, size_t CAPACITY>
+wait_awaiter async_receive(queue<item_type, CAPACITY>& queue, item_type& buffer, ticks_t timeout = MAX_TICKS) noexcept
+{
+    return wait_awaiter([&queue, &buffer] {return queue.receive(buffer, ticks_t(0));}, timeout);
+}
+
+/**
+ * Take the semaphore without blocking the scheduler task
+ * @returns Awaitable which results in `false` on timeout
+ */
+inline wait_awaiter async_take(semaphore& semaphore, ticks_t timeout = MAX_TICKS) noexcept
+{
+    return wait_awaiter([&semaphore] {return semaphore.take(ticks_t(0));}, timeout);
+}
+
+/**
+ * Read from the device using `read_async`
+ * @returns Awaitable which results in the number of bytes read or a negative error
+ */
+inline async_op_awaiter async_read(driver::char_dev& device, char* buffer, size_t size) noexcept
+{
+    return async_op_awaiter([&device, buffer, size](const async_op_awaiter::callback_t& callback) {
+        return device.read_async(buffer, size, callback);
+    });
+}
+
+/**
+ * Write to the device using `write_async`
+ * @returns Awaitable which results in the number of bytes written or a negative error
+ */
+inline async_op_awaiter async_write(driver::char_dev& device, const char* data, size_t size) noexcept
+{
+    return async_op_awaiter([&device, data, size](const async_op_awaiter::callback_t& callback) {
+        return device.write_async(data, size, callback);
+    });
+}
+
+/**
+ * Read from the device with the given address using `i2c_bus::read_async`
+ * @returns Awaitable which results in the number of bytes read or a negative error
+ */
+inline async_op_awaiter async_read(driver::i2c_bus& bus, driver::i2c_address_t address, char* buffer, size_t size) noexcept
+{
+    return async_op_awaiter([&bus, address, buffer, size](const async_op_awaiter::callback_t& callback) {
+        return bus.read_async(address, buffer, size, callback);
+    });
+}
+
+/**
+ * Write to the device with the given address using `i2c_bus::write_async`
+ * @returns Awaitable which results in the number of bytes written or a negative error
+ */
+inline async_op_awaiter async_write(driver::i2c_bus& bus, driver::i2c_address_t address, const char* data, size_t size) noexcept
+{
+    return async_op_awaiter([&bus, address, data, size](const async_op_awaiter::callback_t& callback) {
+        return bus.write_async(address, data, size, callback);
+    });
+}
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
+
+#endif
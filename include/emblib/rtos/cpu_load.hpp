@@ -0,0 +1,65 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/rtos/task.hpp"
+
+namespace emblib::rtos {
+
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+
+/**
+ * System wide CPU load sampler
+ *
+ * Load is the fraction of the runtime stats counter which was not spent
+ * in the idle task between two samples, so call `sample` periodically,
+ * for example once per second from a low priority task.
+ */
+class cpu_load {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_counter_t = configRUN_TIME_COUNTER_TYPE;
+#else
+    #error "CPU load implementation missing"
+#endif
+
+    explicit cpu_load() = default;
+
+    /**
+     * Measure the load since the previous sample
+     * @returns Load in range [0, 1]
+     * @note First sample covers the time since the scheduler started
+     */
+    float sample() noexcept;
+
+    /**
+     * Load measured by the last call to `sample`
+     */
+    float get_load() const noexcept
+    {
+        return m_load;
+    }
+
+private:
+    native_counter_t m_prev_total = 0;
+    native_counter_t m_prev_idle = 0;
+    float m_load = 0.0f;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/cpu_load_inline.hpp"
+#else
+#error "CPU load implementation missing"
+#endif
+
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,116 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/event_group.hpp"
+#else
+    #error "Event group implementation missing"
+#endif
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/task.hpp"
+
+namespace emblib::rtos {
+
+/**
+ * Set of event flags which tasks can wait on
+ *
+ * Tasks can block until any or all of the selected bits are set, which
+ * also allows synchronizing multiple tasks at a rendezvous point.
+ * @note Only the lower `get_bit_count()` bits are usable
+ */
+class event_group {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_event_group_t = freertos::event_group;
+    using bits_t = EventBits_t;
+#else
+    #error "Event group implementation missing"
+#endif
+
+    explicit event_group() = default;
+
+    /* Copy operations not allowed */
+    event_group(const event_group&) = delete;
+    event_group& operator=(const event_group&) = delete;
+
+    /* Move operations not allowed */
+    event_group(event_group&&) = delete;
+    event_group& operator=(event_group&&) = delete;
+
+    /**
+     * Number of usable event bits
+     */
+    static constexpr size_t get_bit_count() noexcept;
+
+    /**
+     * Set bits, unblocking the tasks waiting on them
+     * @returns Bits at the time this returns, waiting tasks may have already cleared the set bits
+     */
+    bits_t set(bits_t bits) noexcept;
+
+    /**
+     * Set bits from an interrupt routine
+     * @returns `false` if the request could not be queued
+     * @note Setting is deferred to the timer daemon task, since
+     * unblocking an unknown number of tasks is not deterministic
+     */
+    bool set_from_isr(bits_t bits, isr_context* context = nullptr) noexcept;
+
+    /**
+     * Clear bits
+     * @returns Bits before clearing
+     */
+    bits_t clear(bits_t bits) noexcept;
+
+    /**
+     * Get the current bits
+     */
+    bits_t get() const noexcept;
+
+    /**
+     * Get the current bits from an interrupt routine
+     */
+    bits_t get_from_isr() const noexcept;
+
+    /**
+     * Wait until any (or all if `wait_all`) of the `bits` are set
+     * @returns Bits at the time the wait ended, before clearing, check them
+     * against `bits` to find out if the wait timed out
+     */
+    bits_t wait(bits_t bits, bool wait_all = false, bool clear_on_exit = true, ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Set `set_bits` and wait until all the `wait_bits` are set, which
+     * are then cleared atomically
+     * @note Used as a rendezvous of multiple tasks, each setting its own bit
+     */
+    bits_t sync(bits_t set_bits, bits_t wait_bits, ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Get reference to the underlying event group object
+     */
+    native_event_group_t& get_native_event_group() noexcept
+    {
+        return m_native_event_group;
+    }
+
+private:
+    native_event_group_t m_native_event_group;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/event_group_inline.hpp"
+#else
+#error "Event group implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
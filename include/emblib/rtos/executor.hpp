@@ -0,0 +1,221 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/common/inplace_function.hpp"
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/pool.hpp"
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/task.hpp"
+#include <utility>
+
+namespace emblib::rtos {
+
+/**
+ * Pool of `WORKER_COUNT` tasks running jobs from a shared bounded queue
+ *
+ * Jobs are stored in a static pool of `QUEUE_CAPACITY` slots and only
+ * pointers to them pass through the queues, so posting never allocates
+ * and is allowed from interrupt routines. High priority jobs are always
+ * taken before normal ones, while jobs of the same priority run in the
+ * order they were posted. With more than one worker, jobs may run
+ * concurrently (in parallel on multicore builds).
+ */
+template <size_t WORKER_COUNT, size_t QUEUE_CAPACITY, size_t STACK_SIZE_BYTES>
+class executor {
+
+    static_assert(WORKER_COUNT > 0, "Need at least one worker");
+
+public:
+    enum class priority_e {NORMAL, HIGH};
+
+    /* Typedef of a job, captures must fit into the inplace function */
+    using job_t = inplace_function<void ()>;
+
+    /**
+     * Create the worker tasks, all with the same `task_priority`
+     * @note Each worker is named by its index appended to `name`,
+     * which is cut off if needed to fit `MAX_NAME_LENGTH`
+     */
+    explicit executor(const char* name, size_t task_priority) noexcept :
+        executor(name, task_priority, std::make_index_sequence<WORKER_COUNT>())
+    {}
+
+    /* Copy operations not allowed */
+    executor(const executor&) = delete;
+    executor& operator=(const executor&) = delete;
+
+    /* Move operations not allowed */
+    executor(executor&&) = delete;
+    executor& operator=(executor&&) = delete;
+
+    /**
+     * Queue a job to run on one of the workers
+     * @returns `false` if the queue is full
+     */
+    bool post(job_t job, priority_e priority = priority_e::NORMAL) noexcept
+    {
+        job_t* slot = m_job_pool.create(std::move(job));
+        if (!slot) {
+            return false;
+        }
+        if (!get_queue(priority).send(slot, ticks_t(0))) {
+            m_job_pool.destroy(slot);
+            return false;
+        }
+        m_job_count.give();
+        return true;
+    }
+
+    /**
+     * Queue a job from an interrupt routine
+     * @returns `false` if the queue is full
+     */
+    bool post_from_isr(job_t job, priority_e priority = priority_e::NORMAL, isr_context* context = nullptr) noexcept
+    {
+        job_t* slot = m_job_pool.create(std::move(job));
+        if (!slot) {
+            return false;
+        }
+        if (!get_queue(priority).send_from_isr(slot, context)) {
+            m_job_pool.destroy(slot);
+            return false;
+        }
+        m_job_count.give_from_isr(context);
+        return true;
+    }
+
+    /**
+     * Number of jobs posted but not finished yet
+     */
+    size_t get_pending() const noexcept
+    {
+        return m_job_pool.get_used();
+    }
+
+    /**
+     * Largest number of jobs which were pending at the same time
+     * @note Use to size the queue capacity
+     */
+    size_t get_max_pending() const noexcept
+    {
+        return m_job_pool.get_max_used();
+    }
+
+    /**
+     * Worker task with the given index, for example to check its stack usage
+     */
+    const task& get_worker(size_t index) const noexcept
+    {
+        return m_workers[index];
+    }
+
+    /**
+     * Name of the worker task with the given index
+     */
+    const char* get_worker_name(size_t index) const noexcept
+    {
+        return m_worker_names[index];
+    }
+
+    /**
+     * Maximum length of the worker names, including the terminating null
+     */
+    static constexpr size_t MAX_NAME_LENGTH = 16;
+
+private:
+    using job_queue_t = queue<job_t*, QUEUE_CAPACITY>;
+
+    class worker : public task {
+    public:
+        worker(executor& executor, const char* name, size_t priority) :
+            task(name, priority, m_stack),
+            m_executor(executor)
+        {}
+
+    private:
+        void run() noexcept override
+        {
+            while (true) {
+                m_executor.run_next();
+            }
+        }
+
+        executor& m_executor;
+        task_stack_t<STACK_SIZE_BYTES> m_stack;
+    };
+
+    template <size_t... INDICES>
+    explicit executor(const char* name, size_t task_priority, std::index_sequence<INDICES...>) noexcept :
+        m_workers {worker(*this, make_worker_name(INDICES, name), task_priority)...}
+    {}
+
+    /**
+     * Write the worker name with its index appended into the names array
+     * @note Called while constructing the workers, so the name outlives the task
+     */
+    const char* make_worker_name(size_t index, const char* name) noexcept
+    {
+        char* worker_name = m_worker_names[index];
+
+        char digits[20];
+        size_t digit_count = 0;
+        do {
+            digits[digit_count++] = '0' + index % 10;
+            index /= 10;
+        } while (index > 0);
+
+        size_t length = 0;
+        while (name[length] && length + digit_count < MAX_NAME_LENGTH - 1) {
+            worker_name[length] = name[length];
+            length++;
+        }
+        while (digit_count > 0) {
+            worker_name[length++] = digits[--digit_count];
+        }
+        worker_name[length] = '\0';
+        return worker_name;
+    }
+
+    job_queue_t& get_queue(priority_e priority) noexcept
+    {
+        return priority == priority_e::HIGH ? m_high_jobs : m_normal_jobs;
+    }
+
+    /**
+     * Wait for a job and run it
+     * @note Count of the semaphore is never larger than the number of queued
+     * jobs, so once it is taken one of the queues surely has a job
+     */
+    void run_next() noexcept
+    {
+        m_job_count.take();
+
+        job_t* job = nullptr;
+        if (!m_high_jobs.receive(job, ticks_t(0))) {
+            m_normal_jobs.receive(job, ticks_t(0));
+        }
+
+        (*job)();
+        m_job_pool.destroy(job);
+    }
+
+private:
+    pool<job_t, QUEUE_CAPACITY> m_job_pool;
+    job_queue_t m_high_jobs;
+    job_queue_t m_normal_jobs;
+    semaphore m_job_count {QUEUE_CAPACITY, 0};
+
+    /* Task names are kept here since some backends don't copy them */
+    char m_worker_names[WORKER_COUNT][MAX_NAME_LENGTH];
+    worker m_workers[WORKER_COUNT];
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,18 @@
+#pragma once
+
+inline float cpu_load::sample() noexcept
+{
+    const native_counter_t total = freertos::get_runtime_counter();
+    const native_counter_t idle = freertos::get_idle_runtime_counter();
+
+    /* Unsigned differences are correct even if the counters wrapped around */
+    const native_counter_t total_delta = total - m_prev_total;
+    const native_counter_t idle_delta = idle - m_prev_idle;
+    m_prev_total = total;
+    m_prev_idle = idle;
+
+    if (total_delta > 0) {
+        m_load = 1.0f - static_cast<float>(idle_delta) / static_cast<float>(total_delta);
+    }
+    return m_load;
+}
@@ -0,0 +1,42 @@
+#pragma once
+
+inline constexpr size_t event_group::get_bit_count() noexcept
+{
+    /* Top byte of the event bits is reserved for the kernel */
+    return sizeof(EventBits_t) * 8 - 8;
+}
+
+inline event_group::bits_t event_group::set(bits_t bits) noexcept
+{
+    return m_native_event_group.set(bits);
+}
+
+inline bool event_group::set_from_isr(bits_t bits, isr_context* context) noexcept
+{
+    return m_native_event_group.set_from_isr(bits, get_native_task_woken(context));
+}
+
+inline event_group::bits_t event_group::clear(bits_t bits) noexcept
+{
+    return m_native_event_group.clear(bits);
+}
+
+inline event_group::bits_t event_group::get() const noexcept
+{
+    return m_native_event_group.get();
+}
+
+inline event_group::bits_t event_group::get_from_isr() const noexcept
+{
+    return m_native_event_group.get_from_isr();
+}
+
+inline event_group::bits_t event_group::wait(bits_t bits, bool wait_all, bool clear_on_exit, ticks_t timeout) noexcept
+{
+    return m_native_event_group.wait(bits, wait_all, clear_on_exit, get_native_ticks(timeout));
+}
+
+inline event_group::bits_t event_group::sync(bits_t set_bits, bits_t wait_bits, ticks_t timeout) noexcept
+{
+    return m_native_event_group.sync(set_bits, wait_bits, get_native_ticks(timeout));
+}
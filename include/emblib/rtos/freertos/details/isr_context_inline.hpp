@@ -0,0 +1,9 @@
+#pragma once
+
+/**
+ * Get the native woken flag of the context, `NULL` if there is no context
+ */
+inline BaseType_t* get_native_task_woken(isr_context* context) noexcept
+{
+    return context ? context->get_native_isr_context().get_task_woken() : NULL;
+}
@@ -0,0 +1,85 @@
+#pragma once
+
+#if defined(__unix__) || defined(__APPLE__)
+
+/* FreeRTOS POSIX port, the host monotonic clock is available */
+inline monotonic_clock::time_point monotonic_clock::now() noexcept
+{
+    timespec time;
+    clock_gettime(CLOCK_MONOTONIC, &time);
+    return time_point(duration(static_cast<rep>(time.tv_sec) * 1000000000 + time.tv_nsec));
+}
+
+#elif configGENERATE_RUN_TIME_STATS
+
+inline monotonic_clock::time_point monotonic_clock::now() noexcept
+{
+    static_assert(RUNTIME_COUNTER_HZ > 0, "Runtime counter frequency must be set");
+    using counter_t = configRUN_TIME_COUNTER_TYPE;
+
+    uint64_t counter;
+    if constexpr (sizeof(counter_t) >= sizeof(uint64_t)) {
+        counter = portGET_RUN_TIME_COUNTER_VALUE();
+    }
+    else {
+        /* Count the wraparounds of the counter to extend it to 64 bits */
+        static counter_t s_last_counter = 0;
+        static uint64_t s_high = 0;
+
+        const UBaseType_t state = taskENTER_CRITICAL_FROM_ISR();
+        const counter_t current = portGET_RUN_TIME_COUNTER_VALUE();
+        if (current < s_last_counter) {
+            s_high += uint64_t(1) << (8 * sizeof(counter_t));
+        }
+        s_last_counter = current;
+        counter = s_high + current;
+        taskEXIT_CRITICAL_FROM_ISR(state);
+    }
+
+    /* Split to avoid overflow of the multiplication */
+    constexpr uint64_t HZ = RUNTIME_COUNTER_HZ;
+    const uint64_t seconds = counter / HZ;
+    const uint64_t fraction = counter % HZ;
+    return time_point(duration(static_cast<rep>(seconds * 1000000000 + fraction * 1000000000 / HZ)));
+}
+
+#else
+
+/* No high resolution counter, resolution is a single tick */
+inline monotonic_clock::time_point monotonic_clock::now() noexcept
+{
+    uint64_t ticks;
+    if constexpr (sizeof(TickType_t) >= sizeof(uint64_t)) {
+        ticks = xTaskGetTickCountFromISR();
+    }
+    else {
+        /* Count the wraparounds of the tick count to extend it to 64 bits,
+         * same as the runtime counter, so the clock never goes back */
+        static TickType_t s_last_ticks = 0;
+        static uint64_t s_high = 0;
+
+        const UBaseType_t state = taskENTER_CRITICAL_FROM_ISR();
+        const TickType_t current = xTaskGetTickCountFromISR();
+        if (current < s_last_ticks) {
+            s_high += uint64_t(1) << (8 * sizeof(TickType_t));
+        }
+        s_last_ticks = current;
+        ticks = s_high + current;
+        taskEXIT_CRITICAL_FROM_ISR(state);
+    }
+    return time_point(std::chrono::duration_cast<duration>(ticks_t(static_cast<int64_t>(ticks))));
+}
+
+#endif
+
+inline void monotonic_clock::delay_until(time_point deadline) noexcept
+{
+    /* Sleep all but the last tick, which is spun since the
+     * sleep could end anywhere within the current tick */
+    const duration remaining = deadline - now();
+    const ticks_t sleep_ticks = std::chrono::floor<ticks_t>(remaining) - ticks_t(1);
+    if (sleep_ticks > ticks_t(0)) {
+        task::sleep(sleep_ticks);
+    }
+    while (now() < deadline) {}
+}
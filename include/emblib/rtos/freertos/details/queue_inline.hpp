@@ -3,23 +3,41 @@
 template <typename item_type, size_t CAPACITY>
 bool queue<item_type, CAPACITY>::send(const item_type& item, ticks_t timeout) noexcept
 {
-    return m_native_queue.send(item, timeout.count());
+    return m_native_queue.send(item, get_native_ticks(timeout));
 }
 
 template <typename item_type, size_t CAPACITY>
-bool queue<item_type, CAPACITY>::send_from_isr(const item_type& item) noexcept
+bool queue<item_type, CAPACITY>::send_from_isr(const item_type& item, isr_context* context) noexcept
 {
-    return m_native_queue.send_from_isr(item);
+    return m_native_queue.send_from_isr(item, get_native_task_woken(context));
+}
+
+template <typename item_type, size_t CAPACITY>
+size_t queue<item_type, CAPACITY>::send_n(const item_type* items, size_t count, ticks_t timeout) noexcept
+{
+    return m_native_queue.send_n(items, count, get_native_ticks(timeout));
 }
 
 template <typename item_type, size_t CAPACITY>
 bool queue<item_type, CAPACITY>::receive(item_type& buffer, ticks_t timeout) noexcept
 {
-    return m_native_queue.receive(buffer, timeout.count());
+    return m_native_queue.receive(buffer, get_native_ticks(timeout));
+}
+
+template <typename item_type, size_t CAPACITY>
+bool queue<item_type, CAPACITY>::receive_from_isr(item_type& buffer, isr_context* context) noexcept
+{
+    return m_native_queue.receive_from_isr(buffer, get_native_task_woken(context));
+}
+
+template <typename item_type, size_t CAPACITY>
+size_t queue<item_type, CAPACITY>::receive_n(item_type* buffer, size_t count, ticks_t timeout) noexcept
+{
+    return m_native_queue.receive_n(buffer, count, get_native_ticks(timeout));
 }
 
 template <typename item_type, size_t CAPACITY>
 bool queue<item_type, CAPACITY>::peek(item_type& buffer, ticks_t timeout) noexcept
 {
-    return m_native_queue.peek(buffer, timeout.count());
+    return m_native_queue.peek(buffer, get_native_ticks(timeout));
 }
\ No newline at end of file
@@ -0,0 +1,52 @@
+#pragma once
+
+template <size_t CAPACITY>
+template <typename item_type, size_t QUEUE_CAPACITY>
+bool queue_set<CAPACITY>::add(queue<item_type, QUEUE_CAPACITY>& queue) noexcept
+{
+    return m_native_queue_set.add(queue.get_native_queue().get_handle());
+}
+
+template <size_t CAPACITY>
+bool queue_set<CAPACITY>::add(semaphore& semaphore) noexcept
+{
+    return m_native_queue_set.add(semaphore.get_native_semaphore().get_handle());
+}
+
+template <size_t CAPACITY>
+template <typename item_type, size_t QUEUE_CAPACITY>
+bool queue_set<CAPACITY>::remove(queue<item_type, QUEUE_CAPACITY>& queue) noexcept
+{
+    return m_native_queue_set.remove(queue.get_native_queue().get_handle());
+}
+
+template <size_t CAPACITY>
+bool queue_set<CAPACITY>::remove(semaphore& semaphore) noexcept
+{
+    return m_native_queue_set.remove(semaphore.get_native_semaphore().get_handle());
+}
+
+template <size_t CAPACITY>
+typename queue_set<CAPACITY>::member_t queue_set<CAPACITY>::select(ticks_t timeout) noexcept
+{
+    return m_native_queue_set.select(get_native_ticks(timeout));
+}
+
+template <size_t CAPACITY>
+typename queue_set<CAPACITY>::member_t queue_set<CAPACITY>::select_from_isr() noexcept
+{
+    return m_native_queue_set.select_from_isr();
+}
+
+template <size_t CAPACITY>
+template <typename item_type, size_t QUEUE_CAPACITY>
+bool queue_set<CAPACITY>::is_selected(member_t member, queue<item_type, QUEUE_CAPACITY>& queue) noexcept
+{
+    return member != nullptr && member == queue.get_native_queue().get_handle();
+}
+
+template <size_t CAPACITY>
+bool queue_set<CAPACITY>::is_selected(member_t member, semaphore& semaphore) noexcept
+{
+    return member != nullptr && member == semaphore.get_native_semaphore().get_handle();
+}
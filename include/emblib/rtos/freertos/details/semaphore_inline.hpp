@@ -0,0 +1,21 @@
+#pragma once
+
+inline semaphore::semaphore(size_t max_count, size_t initial_count) noexcept :
+    m_native_semaphore(max_count, initial_count)
+{
+}
+
+inline bool semaphore::take(ticks_t timeout) noexcept
+{
+    return m_native_semaphore.take(get_native_ticks(timeout));
+}
+
+inline bool semaphore::give() noexcept
+{
+    return m_native_semaphore.give();
+}
+
+inline bool semaphore::give_from_isr(isr_context* context) noexcept
+{
+    return m_native_semaphore.give_from_isr(get_native_task_woken(context));
+}
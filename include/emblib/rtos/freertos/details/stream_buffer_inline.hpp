@@ -0,0 +1,25 @@
+#pragma once
+
+template <size_t CAPACITY_BYTES>
+size_t stream_buffer<CAPACITY_BYTES>::send(const void* data, size_t size, ticks_t timeout) noexcept
+{
+    return m_native_stream_buffer.send(data, size, get_native_ticks(timeout));
+}
+
+template <size_t CAPACITY_BYTES>
+size_t stream_buffer<CAPACITY_BYTES>::send_from_isr(const void* data, size_t size, isr_context* context) noexcept
+{
+    return m_native_stream_buffer.send_from_isr(data, size, get_native_task_woken(context));
+}
+
+template <size_t CAPACITY_BYTES>
+size_t stream_buffer<CAPACITY_BYTES>::receive(void* buffer, size_t size, ticks_t timeout) noexcept
+{
+    return m_native_stream_buffer.receive(buffer, size, get_native_ticks(timeout));
+}
+
+template <size_t CAPACITY_BYTES>
+size_t stream_buffer<CAPACITY_BYTES>::receive_from_isr(void* buffer, size_t size, isr_context* context) noexcept
+{
+    return m_native_stream_buffer.receive_from_isr(buffer, size, get_native_task_woken(context));
+}
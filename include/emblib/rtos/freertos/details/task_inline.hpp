@@ -1,5 +1,25 @@
 #pragma once
 
+static_assert(ticks_t::period::num == 1 && ticks_t::period::den == configTICK_RATE_HZ,
+    "RTOS tick rate in emblib_config.hpp does not match configTICK_RATE_HZ");
+
+/**
+ * Convert the duration to FreeRTOS ticks, keeping `MAX_TICKS` as indefinite
+ * @note Durations longer than the tick type can hold are clamped
+ * to the longest finite timeout instead of wrapping around
+ */
+inline TickType_t get_native_ticks(ticks_t ticks) noexcept
+{
+    if (ticks == MAX_TICKS) {
+        return portMAX_DELAY;
+    }
+    if (ticks.count() <= 0) {
+        return 0;
+    }
+    constexpr int64_t MAX_FINITE = static_cast<int64_t>(portMAX_DELAY) - 1;
+    return static_cast<TickType_t>(ticks.count() < MAX_FINITE ? ticks.count() : MAX_FINITE);
+}
+
 template <size_t STACK_SIZE_BYTES>
 inline task::task(const char *name, size_t priority, task_stack_t<STACK_SIZE_BYTES> &stack) :
     m_native_task([this] {this->run();}, name, priority, (freertos::task_stack_t<sizeof(stack) / sizeof(freertos::task_stack_t<1>)>&)stack)
@@ -11,20 +31,53 @@ inline void task::start_tasks() noexcept
     freertos::start_scheduler();
 }
 
+inline void task::stop_tasks() noexcept
+{
+    vTaskEndScheduler();
+}
+
 inline void task::sleep(ticks_t duration) noexcept
 {
-    vTaskDelay(duration.count());
+    vTaskDelay(get_native_ticks(duration));
+}
+
+inline ticks_t task::get_tick_count() noexcept
+{
+    return ticks_t(xTaskGetTickCount());
+}
+
+inline ticks_t task::get_ticks_between(ticks_t start, ticks_t end) noexcept
+{
+    /* Unsigned difference of the native ticks is correct across the wraparound */
+    return ticks_t(static_cast<TickType_t>(static_cast<TickType_t>(end.count()) - static_cast<TickType_t>(start.count())));
+}
+
+inline bool task::sleep_periodic(ticks_t period) noexcept
+{
+    return m_native_task.sleep_periodic(get_native_ticks(period));
+}
+
+inline size_t task::get_stack_high_water_mark() const noexcept
+{
+    return m_native_task.get_stack_high_water_mark() * sizeof(StackType_t);
+}
+
+inline uint32_t task::get_deadline_misses() const noexcept
+{
+    return m_native_task.get_deadline_misses();
 }
 
-inline void task::sleep_periodic(ticks_t period) noexcept
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+inline uint64_t task::get_runtime_counter() const noexcept
 {
-    m_native_task.sleep_periodic(period.count());
+    return m_native_task.get_runtime_counter();
 }
+#endif
 
 #if EMBLIB_RTOS_SUPPORT_NOTIFICATIONS
 inline bool task::wait_notification(ticks_t timeout) noexcept
 {
-    return ulTaskNotifyTake(false, timeout.count());
+    return ulTaskNotifyTake(false, get_native_ticks(timeout));
 }
 
 inline void task::notify() noexcept
@@ -32,8 +85,8 @@ inline void task::notify() noexcept
     m_native_task.notify();
 }
 
-inline void task::notify_from_isr() noexcept
+inline void task::notify_from_isr(isr_context* context) noexcept
 {
-    m_native_task.notify_from_isr();
+    m_native_task.notify_from_isr(get_native_task_woken(context));
 }
 #endif
\ No newline at end of file
@@ -0,0 +1,51 @@
+#pragma once
+
+inline timer::timer(const char* name, ticks_t period, mode_e mode, callback_t callback) noexcept :
+    m_native_timer(std::move(callback), name, get_native_ticks(period), mode == mode_e::PERIODIC)
+{
+}
+
+inline bool timer::start(ticks_t timeout) noexcept
+{
+    return m_native_timer.start(get_native_ticks(timeout));
+}
+
+inline bool timer::start_from_isr(isr_context* context) noexcept
+{
+    return m_native_timer.start_from_isr(get_native_task_woken(context));
+}
+
+inline bool timer::stop(ticks_t timeout) noexcept
+{
+    return m_native_timer.stop(get_native_ticks(timeout));
+}
+
+inline bool timer::stop_from_isr(isr_context* context) noexcept
+{
+    return m_native_timer.stop_from_isr(get_native_task_woken(context));
+}
+
+inline bool timer::reset(ticks_t timeout) noexcept
+{
+    return m_native_timer.reset(get_native_ticks(timeout));
+}
+
+inline bool timer::reset_from_isr(isr_context* context) noexcept
+{
+    return m_native_timer.reset_from_isr(get_native_task_woken(context));
+}
+
+inline bool timer::set_period(ticks_t period, ticks_t timeout) noexcept
+{
+    return m_native_timer.set_period(get_native_ticks(period), get_native_ticks(timeout));
+}
+
+inline ticks_t timer::get_period() const noexcept
+{
+    return ticks_t(m_native_timer.get_period());
+}
+
+inline bool timer::is_active() const noexcept
+{
+    return m_native_timer.is_active();
+}
@@ -0,0 +1,78 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <FreeRTOS.h>
+#include <event_groups.h>
+
+namespace emblib::rtos::freertos {
+
+/**
+ * FreeRTOS event group
+ */
+class event_group {
+
+public:
+    explicit event_group() noexcept :
+        m_event_group_handle(xEventGroupCreateStatic(&m_event_group_buffer))
+    {}
+
+    /* Copy operations not allowed */
+    event_group(const event_group&) = delete;
+    event_group& operator=(const event_group&) = delete;
+
+    /* Move operations not allowed */
+    event_group(event_group&&) = delete;
+    event_group& operator=(event_group&&) = delete;
+
+    EventBits_t set(EventBits_t bits) noexcept
+    {
+        return xEventGroupSetBits(m_event_group_handle, bits);
+    }
+
+    /**
+     * Set bits from ISR
+     * @note Deferred to the timer daemon task, fails if its command queue is full
+     */
+    bool set_from_isr(EventBits_t bits, BaseType_t* task_woken = NULL) noexcept
+    {
+        return xEventGroupSetBitsFromISR(m_event_group_handle, bits, task_woken) == pdPASS;
+    }
+
+    EventBits_t clear(EventBits_t bits) noexcept
+    {
+        return xEventGroupClearBits(m_event_group_handle, bits);
+    }
+
+    EventBits_t get() const noexcept
+    {
+        return xEventGroupGetBits(m_event_group_handle);
+    }
+
+    EventBits_t get_from_isr() const noexcept
+    {
+        return xEventGroupGetBitsFromISR(m_event_group_handle);
+    }
+
+    EventBits_t wait(EventBits_t bits, bool wait_all, bool clear_on_exit, TickType_t timeout) noexcept
+    {
+        return xEventGroupWaitBits(
+            m_event_group_handle,
+            bits,
+            clear_on_exit ? pdTRUE : pdFALSE,
+            wait_all ? pdTRUE : pdFALSE,
+            timeout
+        );
+    }
+
+    EventBits_t sync(EventBits_t set_bits, EventBits_t wait_bits, TickType_t timeout) noexcept
+    {
+        return xEventGroupSync(m_event_group_handle, set_bits, wait_bits, timeout);
+    }
+
+private:
+    StaticEventGroup_t m_event_group_buffer;
+    EventGroupHandle_t m_event_group_handle;
+
+};
+
+}
@@ -0,0 +1,52 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <FreeRTOS.h>
+
+namespace emblib::rtos::freertos {
+
+/**
+ * Higher priority task woken flag for the duration of an interrupt routine
+ * @note Requests a context switch on destruction if any `FromISR` call
+ * which was given this context unblocked a higher priority task
+ */
+class isr_context {
+
+public:
+    explicit isr_context() = default;
+
+    ~isr_context() noexcept
+    {
+        portYIELD_FROM_ISR(m_task_woken);
+    }
+
+    /* Copy operations not allowed */
+    isr_context(const isr_context&) = delete;
+    isr_context& operator=(const isr_context&) = delete;
+
+    /* Move operations not allowed */
+    isr_context(isr_context&&) = delete;
+    isr_context& operator=(isr_context&&) = delete;
+
+    /**
+     * Pointer to the flag which is passed to `FromISR` functions
+     */
+    BaseType_t* get_task_woken() noexcept
+    {
+        return &m_task_woken;
+    }
+
+    /**
+     * @returns `true` if a higher priority task was woken
+     */
+    bool is_task_woken() const noexcept
+    {
+        return m_task_woken != pdFALSE;
+    }
+
+private:
+    BaseType_t m_task_woken = pdFALSE;
+
+};
+
+}
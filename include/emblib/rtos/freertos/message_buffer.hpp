@@ -0,0 +1,93 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <FreeRTOS.h>
+#include <message_buffer.h>
+
+namespace emblib::rtos::freertos {
+
+/**
+ * FreeRTOS message buffer
+ */
+template <size_t CAPACITY_BYTES>
+class message_buffer {
+
+public:
+    explicit message_buffer() noexcept :
+        m_message_buffer_handle(xMessageBufferCreateStatic(CAPACITY_BYTES, m_storage, &m_message_buffer_buffer))
+    {}
+
+    /* Copy operations not allowed */
+    message_buffer(const message_buffer&) = delete;
+    message_buffer& operator=(const message_buffer&) = delete;
+
+    /* Move operations not allowed */
+    message_buffer(message_buffer&&) = delete;
+    message_buffer& operator=(message_buffer&&) = delete;
+
+    /**
+     * Message buffer send
+     */
+    size_t send(const void* data, size_t size, TickType_t timeout) noexcept
+    {
+        return xMessageBufferSend(m_message_buffer_handle, data, size, timeout);
+    }
+
+    /**
+     * Message buffer send from ISR
+     */
+    size_t send_from_isr(const void* data, size_t size, BaseType_t* task_woken = NULL) noexcept
+    {
+        return xMessageBufferSendFromISR(m_message_buffer_handle, data, size, task_woken);
+    }
+
+    /**
+     * Message buffer receive
+     */
+    size_t receive(void* buffer, size_t size, TickType_t timeout) noexcept
+    {
+        return xMessageBufferReceive(m_message_buffer_handle, buffer, size, timeout);
+    }
+
+    /**
+     * Message buffer receive from ISR
+     */
+    size_t receive_from_isr(void* buffer, size_t size, BaseType_t* task_woken = NULL) noexcept
+    {
+        return xMessageBufferReceiveFromISR(m_message_buffer_handle, buffer, size, task_woken);
+    }
+
+    /**
+     * Length of the next message
+     */
+    size_t get_next_size() const noexcept
+    {
+        return xMessageBufferNextLengthBytes(m_message_buffer_handle);
+    }
+
+    /**
+     * Number of bytes which can be sent, including the message length
+     */
+    size_t get_free_space() const noexcept
+    {
+        return xMessageBufferSpacesAvailable(m_message_buffer_handle);
+    }
+
+    /**
+     * Discard all the messages, possible only if no task is blocked on this buffer
+     */
+    bool reset() noexcept
+    {
+        return xMessageBufferReset(m_message_buffer_handle) == pdPASS;
+    }
+
+private:
+    StaticMessageBuffer_t m_message_buffer_buffer;
+    MessageBufferHandle_t m_message_buffer_handle;
+
+    /* FreeRTOS requires one byte more than the capacity */
+    uint8_t m_storage[CAPACITY_BYTES + 1];
+
+};
+
+}
@@ -3,6 +3,7 @@
 #include "emblib/emblib.hpp"
 #include <FreeRTOS.h>
 #include <queue.h>
+#include <task.h>
 
 namespace emblib::rtos::freertos {
 
@@ -35,10 +36,46 @@ public:
 
     /**
      * Queue send from ISR
+     * @param task_woken Set to `pdTRUE` if a higher priority task was unblocked
      */
-    bool send_from_isr(const item_type& item) noexcept
+    bool send_from_isr(const item_type& item, BaseType_t* task_woken = NULL) noexcept
     {
-        return xQueueSendFromISR(m_queue_handle, &item, NULL) == pdTRUE;
+        return xQueueSendFromISR(m_queue_handle, &item, task_woken) == pdTRUE;
+    }
+
+    /**
+     * Send up to `count` items, blocking while the queue is full
+     * until `timeout` expires for the whole batch
+     * @returns Number of items sent
+     * @note This is not a batched kernel path, FreeRTOS has no API for
+     * copying multiple items into a queue, so each item is still a separate
+     * `xQueueSend`. Items which fit are sent with the scheduler suspended,
+     * which only saves switching to a higher priority receiving task after
+     * each item. Use a stream or message buffer for bulk copies.
+     */
+    size_t send_n(const item_type* items, size_t count, TickType_t timeout) noexcept
+    {
+        TimeOut_t timeout_state;
+        vTaskSetTimeOutState(&timeout_state);
+
+        size_t sent = 0;
+        while (sent < count) {
+            vTaskSuspendAll();
+            while (sent < count && xQueueSend(m_queue_handle, &items[sent], 0) == pdTRUE) {
+                sent++;
+            }
+            xTaskResumeAll();
+
+            /* Queue is full, block until there is space for the next item */
+            if (sent == count || xTaskCheckForTimeOut(&timeout_state, &timeout) == pdTRUE) {
+                break;
+            }
+            if (xQueueSend(m_queue_handle, &items[sent], timeout) != pdTRUE) {
+                break;
+            }
+            sent++;
+        }
+        return sent;
     }
 
     /**
@@ -49,6 +86,36 @@ public:
         return xQueueReceive(m_queue_handle, &buffer, timeout) == pdTRUE;
     }
 
+    /**
+     * Receive item from queue from ISR
+     */
+    bool receive_from_isr(item_type& buffer, BaseType_t* task_woken = NULL) noexcept
+    {
+        return xQueueReceiveFromISR(m_queue_handle, &buffer, task_woken) == pdTRUE;
+    }
+
+    /**
+     * Wait up to `timeout` for at least one item, then receive
+     * all available items up to `count` without blocking
+     * @returns Number of items received
+     * @note Each item is a separate `xQueueReceive`, with the scheduler
+     * suspended while draining so a woken sender does not preempt it
+     */
+    size_t receive_n(item_type* buffer, size_t count, TickType_t timeout) noexcept
+    {
+        if (count == 0 || xQueueReceive(m_queue_handle, &buffer[0], timeout) != pdTRUE) {
+            return 0;
+        }
+
+        size_t received = 1;
+        vTaskSuspendAll();
+        while (received < count && xQueueReceive(m_queue_handle, &buffer[received], 0) == pdTRUE) {
+            received++;
+        }
+        xTaskResumeAll();
+        return received;
+    }
+
     /**
      * Peek queue
      */
@@ -57,6 +124,14 @@ public:
         return xQueuePeek(m_queue_handle, &buffer, timeout) == pdTRUE;
     }
 
+    /**
+     * Get the FreeRTOS queue handle, used for adding the queue to a queue set
+     */
+    QueueHandle_t get_handle() const noexcept
+    {
+        return m_queue_handle;
+    }
+
 private:
     QueueHandle_t m_queue_handle;
     StaticQueue_t m_queue_buffer;
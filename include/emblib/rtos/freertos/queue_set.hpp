@@ -0,0 +1,64 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <FreeRTOS.h>
+#include <queue.h>
+
+namespace emblib::rtos::freertos {
+
+/**
+ * FreeRTOS queue set, where `CAPACITY` is the sum of the lengths of all the member queues
+ */
+template <size_t CAPACITY>
+class queue_set {
+
+public:
+    explicit queue_set() noexcept :
+        m_queue_set_handle(xQueueCreateSetStatic(CAPACITY, m_storage, &m_queue_set_buffer))
+    {}
+
+    /* Copy operations not allowed */
+    queue_set(const queue_set&) = delete;
+    queue_set& operator=(const queue_set&) = delete;
+
+    /* Move operations not allowed */
+    queue_set(queue_set&&) = delete;
+    queue_set& operator=(queue_set&&) = delete;
+
+    /**
+     * Add queue or semaphore to the set
+     * @note Member must be empty when added
+     */
+    bool add(QueueSetMemberHandle_t member) noexcept
+    {
+        return xQueueAddToSet(member, m_queue_set_handle) == pdPASS;
+    }
+
+    /**
+     * Remove queue or semaphore from the set
+     * @note Member must be empty when removed
+     */
+    bool remove(QueueSetMemberHandle_t member) noexcept
+    {
+        return xQueueRemoveFromSet(member, m_queue_set_handle) == pdPASS;
+    }
+
+    QueueSetMemberHandle_t select(TickType_t timeout) noexcept
+    {
+        return xQueueSelectFromSet(m_queue_set_handle, timeout);
+    }
+
+    QueueSetMemberHandle_t select_from_isr() noexcept
+    {
+        return xQueueSelectFromSetFromISR(m_queue_set_handle);
+    }
+
+private:
+    QueueSetHandle_t m_queue_set_handle;
+    StaticQueue_t m_queue_set_buffer;
+
+    uint8_t m_storage[CAPACITY * sizeof(QueueSetMemberHandle_t)];
+
+};
+
+}
@@ -3,6 +3,7 @@
 #include "emblib/emblib.hpp"
 #include <FreeRTOS.h>
 #include <semphr.h>
+#include <task.h>
 
 namespace emblib::rtos::freertos {
 
@@ -60,11 +61,19 @@ public:
      * Semaphore give from interrupt routine
      * @note Use this to make sure that task which was
      * interrupted does not block accidentally
-     * @todo Can add higher prio task woken
+     * @param task_woken Set to `pdTRUE` if a higher priority task was unblocked
      */
-    bool give_from_isr() noexcept
+    bool give_from_isr(BaseType_t* task_woken = NULL) noexcept
     {
-        return xSemaphoreGiveFromISR(m_semaphore_handle, NULL) == pdTRUE;
+        return xSemaphoreGiveFromISR(m_semaphore_handle, task_woken) == pdTRUE;
+    }
+
+    /**
+     * Get the FreeRTOS semaphore handle, used for adding the semaphore to a queue set
+     */
+    SemaphoreHandle_t get_handle() const noexcept
+    {
+        return m_semaphore_handle;
     }
 
 private:
@@ -81,6 +90,52 @@ public:
         semaphore(true)
     {}
 
+    /**
+     * Check if the calling task holds the mutex
+     * @note Before the scheduler starts there is no current task, so a
+     * taken mutex is held by the caller
+     */
+    bool is_held() const noexcept
+    {
+        return uxSemaphoreGetCount(get_handle()) == 0 && xSemaphoreGetMutexHolder(get_handle()) == xTaskGetCurrentTaskHandle();
+    }
+
+};
+
+
+/**
+ * FreeRTOS recursive mutex, can be taken again by the task which holds it
+ * @note Must be given as many times as it was taken
+ */
+class recursive_mutex {
+
+public:
+    explicit recursive_mutex() noexcept :
+        m_semaphore_handle(xSemaphoreCreateRecursiveMutexStatic(&m_semaphore_buffer))
+    {}
+
+    /* Copy operations not allowed */
+    recursive_mutex(const recursive_mutex&) = delete;
+    recursive_mutex& operator=(const recursive_mutex&) = delete;
+
+    /* Move operations not allowed */
+    recursive_mutex(recursive_mutex&&) = delete;
+    recursive_mutex& operator=(recursive_mutex&&) = delete;
+
+    bool take(TickType_t ticks) noexcept
+    {
+        return xSemaphoreTakeRecursive(m_semaphore_handle, ticks) == pdTRUE;
+    }
+
+    bool give() noexcept
+    {
+        return xSemaphoreGiveRecursive(m_semaphore_handle) == pdTRUE;
+    }
+
+private:
+    StaticSemaphore_t m_semaphore_buffer;
+    SemaphoreHandle_t m_semaphore_handle;
+
 };
 
 }
\ No newline at end of file
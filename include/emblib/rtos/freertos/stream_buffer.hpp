@@ -0,0 +1,101 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <FreeRTOS.h>
+#include <stream_buffer.h>
+
+namespace emblib::rtos::freertos {
+
+/**
+ * FreeRTOS stream buffer
+ */
+template <size_t CAPACITY_BYTES>
+class stream_buffer {
+
+public:
+    explicit stream_buffer(size_t trigger_level = 1) noexcept :
+        m_stream_buffer_handle(xStreamBufferCreateStatic(CAPACITY_BYTES, trigger_level, m_storage, &m_stream_buffer_buffer))
+    {}
+
+    /* Copy operations not allowed */
+    stream_buffer(const stream_buffer&) = delete;
+    stream_buffer& operator=(const stream_buffer&) = delete;
+
+    /* Move operations not allowed */
+    stream_buffer(stream_buffer&&) = delete;
+    stream_buffer& operator=(stream_buffer&&) = delete;
+
+    /**
+     * Stream buffer send
+     */
+    size_t send(const void* data, size_t size, TickType_t timeout) noexcept
+    {
+        return xStreamBufferSend(m_stream_buffer_handle, data, size, timeout);
+    }
+
+    /**
+     * Stream buffer send from ISR
+     */
+    size_t send_from_isr(const void* data, size_t size, BaseType_t* task_woken = NULL) noexcept
+    {
+        return xStreamBufferSendFromISR(m_stream_buffer_handle, data, size, task_woken);
+    }
+
+    /**
+     * Stream buffer receive
+     */
+    size_t receive(void* buffer, size_t size, TickType_t timeout) noexcept
+    {
+        return xStreamBufferReceive(m_stream_buffer_handle, buffer, size, timeout);
+    }
+
+    /**
+     * Stream buffer receive from ISR
+     */
+    size_t receive_from_isr(void* buffer, size_t size, BaseType_t* task_woken = NULL) noexcept
+    {
+        return xStreamBufferReceiveFromISR(m_stream_buffer_handle, buffer, size, task_woken);
+    }
+
+    /**
+     * Number of bytes which can be received
+     */
+    size_t get_available() const noexcept
+    {
+        return xStreamBufferBytesAvailable(m_stream_buffer_handle);
+    }
+
+    /**
+     * Number of bytes which can be sent
+     */
+    size_t get_free_space() const noexcept
+    {
+        return xStreamBufferSpacesAvailable(m_stream_buffer_handle);
+    }
+
+    /**
+     * Set the number of bytes which unblock a waiting receiver
+     */
+    bool set_trigger_level(size_t trigger_level) noexcept
+    {
+        return xStreamBufferSetTriggerLevel(m_stream_buffer_handle, trigger_level) == pdTRUE;
+    }
+
+    /**
+     * Discard all the data, possible only if no task is blocked on this buffer
+     */
+    bool reset() noexcept
+    {
+        return xStreamBufferReset(m_stream_buffer_handle) == pdPASS;
+    }
+
+private:
+    StaticStreamBuffer_t m_stream_buffer_buffer;
+    StreamBufferHandle_t m_stream_buffer_handle;
+
+    /* FreeRTOS requires one byte more than the capacity */
+    uint8_t m_storage[CAPACITY_BYTES + 1];
+
+};
+
+}
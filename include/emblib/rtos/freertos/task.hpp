@@ -1,9 +1,13 @@
 #pragma once
 
 #include "emblib/emblib.hpp"
+#include "emblib/common/inplace_function.hpp"
 #include <FreeRTOS.h>
 #include <task.h>
-#include <functional>
+
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS && !configGENERATE_RUN_TIME_STATS
+    #error "Runtime stats need configGENERATE_RUN_TIME_STATS in FreeRTOSConfig.h, or set EMBLIB_RTOS_SUPPORT_RUNTIME_STATS to 0"
+#endif
 
 namespace emblib::rtos::freertos {
 
@@ -32,6 +36,24 @@ static inline scheduler_state_e get_scheduler_state() noexcept
     return static_cast<scheduler_state_e>(xTaskGetSchedulerState());
 }
 
+#if configGENERATE_RUN_TIME_STATS
+/**
+ * Current value of the run time stats counter
+ */
+static inline configRUN_TIME_COUNTER_TYPE get_runtime_counter() noexcept
+{
+    return portGET_RUN_TIME_COUNTER_VALUE();
+}
+
+/**
+ * Total time spent in the idle task, in run time stats counter units
+ */
+static inline configRUN_TIME_COUNTER_TYPE get_idle_runtime_counter() noexcept
+{
+    return ulTaskGetIdleRunTimeCounter();
+}
+#endif
+
 /**
  * Stack buffer for a FreeRTOS task, where `SIZE` is the
  * number of words for the allocation
@@ -48,12 +70,12 @@ class task {
 public:
     template <size_t STACK_SIZE>
     explicit task(
-        std::function<void ()> task_func,
+        inplace_function<void ()> task_func,
         const char* name,
         size_t priority,
         task_stack_t<STACK_SIZE>& stack
     ) :
-        m_task_func(task_func),
+        m_task_func(std::move(task_func)),
         m_task_handle(xTaskCreateStatic(
             reinterpret_cast<void (*)(void*)>(&task_entry),
             name,
@@ -75,7 +97,8 @@ public:
 
     /**
      * Sleep relative to previous wake up time
-     * @returns `true` if wakeup was delayed, false if woke up on time
+     * @returns `true` if the task was delayed, `false` if the next wake
+     * up time already passed, which is counted as a deadline miss
      */
     bool sleep_periodic(TickType_t period) noexcept
     {
@@ -83,8 +106,38 @@ public:
             m_first_period = false;
             m_prev_wakeup = xTaskGetTickCount();
         }
-        return xTaskDelayUntil(&m_prev_wakeup, period) == pdTRUE;
+        const bool delayed = xTaskDelayUntil(&m_prev_wakeup, period) == pdTRUE;
+        if (!delayed) {
+            m_deadline_misses++;
+        }
+        return delayed;
+    }
+
+    /**
+     * Number of times `sleep_periodic` was called after the wake up time already passed
+     */
+    uint32_t get_deadline_misses() const noexcept
+    {
+        return m_deadline_misses;
+    }
+
+    /**
+     * Minimum amount of stack space that remained since the task started, in words
+     */
+    configSTACK_DEPTH_TYPE get_stack_high_water_mark() const noexcept
+    {
+        return uxTaskGetStackHighWaterMark2(m_task_handle);
+    }
+
+#if configGENERATE_RUN_TIME_STATS
+    /**
+     * Total time spent running this task, in run time stats counter units
+     */
+    configRUN_TIME_COUNTER_TYPE get_runtime_counter() const noexcept
+    {
+        return ulTaskGetRunTimeCounter(m_task_handle);
     }
+#endif
 
     /**
      * Increment task's notification value (works like a counting semaphore)
@@ -96,18 +149,19 @@ public:
 
     /**
      * Increment task's notification value
-     * @todo Add argument for higher priority task woken
+     * @param task_woken Set to `pdTRUE` if this task has a higher priority
+     * than the interrupted task and was unblocked
      */
-    void notify_from_isr() noexcept
+    void notify_from_isr(BaseType_t* task_woken = NULL) noexcept
     {
-        vTaskNotifyGiveFromISR(m_task_handle, NULL);
+        vTaskNotifyGiveFromISR(m_task_handle, task_woken);
     }
 
 private:
     /**
      * Actual function which is called by the scheduler which then calls the
      * appropriate cpp style task function to allow for passing contexts to
-     * the thread using std::function
+     * the thread using inplace_function
      */
     static void task_entry(task* instance) noexcept
     {
@@ -118,13 +172,14 @@ private:
     }
 
 private:
-    std::function<void ()> m_task_func;
+    inplace_function<void ()> m_task_func;
     
     StaticTask_t m_task_buffer;
     TaskHandle_t m_task_handle;
 
     TickType_t m_prev_wakeup;
     bool m_first_period = true;
+    uint32_t m_deadline_misses = 0;
 };
 
 }
\ No newline at end of file
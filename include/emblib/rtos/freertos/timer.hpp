@@ -0,0 +1,121 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/common/inplace_function.hpp"
+#include <FreeRTOS.h>
+#include <timers.h>
+
+namespace emblib::rtos::freertos {
+
+/**
+ * FreeRTOS software timer
+ * @note Callback is called from the timer daemon task
+ */
+class timer {
+
+public:
+    explicit timer(
+        inplace_function<void ()> callback,
+        const char* name,
+        TickType_t period,
+        bool auto_reload
+    ) noexcept :
+        m_callback(std::move(callback)),
+        m_timer_handle(xTimerCreateStatic(
+            name,
+            period,
+            auto_reload ? pdTRUE : pdFALSE,
+            this,
+            &timer_entry,
+            &m_timer_buffer
+        ))
+    {}
+
+    /* Copy operations not allowed */
+    timer(const timer&) = delete;
+    timer& operator=(const timer&) = delete;
+
+    /* Move operations not allowed */
+    timer(timer&&) = delete;
+    timer& operator=(timer&&) = delete;
+
+    /**
+     * Start the timer
+     * @param ticks Time to wait for space in the timer command queue
+     */
+    bool start(TickType_t ticks) noexcept
+    {
+        return xTimerStart(m_timer_handle, ticks) == pdPASS;
+    }
+
+    bool start_from_isr(BaseType_t* task_woken = NULL) noexcept
+    {
+        return xTimerStartFromISR(m_timer_handle, task_woken) == pdPASS;
+    }
+
+    /**
+     * Stop the timer
+     */
+    bool stop(TickType_t ticks) noexcept
+    {
+        return xTimerStop(m_timer_handle, ticks) == pdPASS;
+    }
+
+    bool stop_from_isr(BaseType_t* task_woken = NULL) noexcept
+    {
+        return xTimerStopFromISR(m_timer_handle, task_woken) == pdPASS;
+    }
+
+    /**
+     * Restart the timer period from now, starts the timer if it is stopped
+     */
+    bool reset(TickType_t ticks) noexcept
+    {
+        return xTimerReset(m_timer_handle, ticks) == pdPASS;
+    }
+
+    bool reset_from_isr(BaseType_t* task_woken = NULL) noexcept
+    {
+        return xTimerResetFromISR(m_timer_handle, task_woken) == pdPASS;
+    }
+
+    /**
+     * Change the period, starts the timer if it is stopped
+     */
+    bool set_period(TickType_t period, TickType_t ticks) noexcept
+    {
+        return xTimerChangePeriod(m_timer_handle, period, ticks) == pdPASS;
+    }
+
+    TickType_t get_period() const noexcept
+    {
+        return xTimerGetPeriod(m_timer_handle);
+    }
+
+    /**
+     * @returns `true` if the timer is running
+     */
+    bool is_active() const noexcept
+    {
+        return xTimerIsTimerActive(m_timer_handle) != pdFALSE;
+    }
+
+private:
+    /**
+     * Callback called by the daemon task, which forwards to the
+     * cpp style callback of the timer instance stored in the timer ID
+     */
+    static void timer_entry(TimerHandle_t timer_handle) noexcept
+    {
+        static_cast<timer*>(pvTimerGetTimerID(timer_handle))->m_callback();
+    }
+
+private:
+    inplace_function<void ()> m_callback;
+
+    StaticTimer_t m_timer_buffer;
+    TimerHandle_t m_timer_handle;
+
+};
+
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/isr_context.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/isr_context.hpp"
+#else
+    #error "Thread implementation missing"
+#endif
+
+namespace emblib::rtos {
+
+/**
+ * Scoped interrupt routine context
+ *
+ * Create at the start of an interrupt routine and pass to the `_from_isr`
+ * methods. If any of them unblocked a task with a higher priority than
+ * the interrupted one, a context switch to it is done when the context
+ * goes out of scope, instead of waiting for the next tick.
+ */
+class isr_context {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_isr_context_t = freertos::isr_context;
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    using native_isr_context_t = stdthread::isr_context;
+#else
+    #error "ISR context implementation missing"
+#endif
+
+    explicit isr_context() = default;
+
+    /* Copy operations not allowed */
+    isr_context(const isr_context&) = delete;
+    isr_context& operator=(const isr_context&) = delete;
+
+    /* Move operations not allowed */
+    isr_context(isr_context&&) = delete;
+    isr_context& operator=(isr_context&&) = delete;
+
+    /**
+     * @returns `true` if a higher priority task was woken in this context
+     */
+    bool is_task_woken() const noexcept
+    {
+        return m_native_isr_context.is_task_woken();
+    }
+
+    /**
+     * Get reference to the underlying context object
+     */
+    native_isr_context_t& get_native_isr_context() noexcept
+    {
+        return m_native_isr_context;
+    }
+
+private:
+    native_isr_context_t m_native_isr_context;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/isr_context_inline.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/details/isr_context_inline.hpp"
+#else
+#error "ISR context implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
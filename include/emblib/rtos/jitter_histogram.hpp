@@ -0,0 +1,199 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/common/logger.hpp"
+#include "emblib/rtos/monotonic_clock.hpp"
+#include <chrono>
+
+namespace emblib::rtos {
+
+/**
+ * Histogram of the wake up jitter of a periodic task
+ *
+ * Jitter is the measured time between two wake ups minus the nominal
+ * period, so it is negative for early wake ups. It is sorted into
+ * `BIN_COUNT` bins of equal width centered around zero, where the first
+ * and the last bin also collect everything outside the range. Minimum
+ * and maximum are tracked exactly, while percentiles are accurate to
+ * the bin width.
+ *
+ * @code
+ * while (true) {
+ *     m_jitter.record_wakeup(sleep_periodic(PERIOD));
+ *     ...
+ * }
+ * @endcode
+ */
+template <size_t BIN_COUNT, typename clock_type = monotonic_clock>
+class jitter_histogram {
+
+    static_assert(BIN_COUNT >= 2, "Need at least two bins");
+
+public:
+    using duration_t = std::chrono::microseconds;
+
+    explicit jitter_histogram(duration_t period, duration_t bin_width) noexcept :
+        m_period(period),
+        m_bin_width(bin_width)
+    {
+        reset();
+    }
+
+    /**
+     * Record a wake up at the current time
+     * @param on_time Result of `task::sleep_periodic`, `false` is counted as an overrun
+     * @note First call only marks the start of measurement
+     */
+    void record_wakeup(bool on_time = true) noexcept
+    {
+        const typename clock_type::time_point now = clock_type::now();
+        if (m_has_prev_wakeup) {
+            record(std::chrono::duration_cast<duration_t>(now - m_prev_wakeup) - m_period);
+        }
+        m_prev_wakeup = now;
+        m_has_prev_wakeup = true;
+
+        if (!on_time) {
+            m_overruns++;
+        }
+    }
+
+    /**
+     * Record a single jitter measurement
+     */
+    void record(duration_t jitter) noexcept
+    {
+        const duration_t lowest = -m_bin_width * static_cast<int>(BIN_COUNT / 2);
+        const auto bin = (jitter - lowest) / m_bin_width;
+        m_bins[bin < 0 ? 0 : (static_cast<size_t>(bin) >= BIN_COUNT ? BIN_COUNT - 1 : bin)]++;
+
+        m_min = (m_count == 0 || jitter < m_min) ? jitter : m_min;
+        m_max = (m_count == 0 || jitter > m_max) ? jitter : m_max;
+        m_count++;
+    }
+
+    /**
+     * Clear all the measurements
+     */
+    void reset() noexcept
+    {
+        for (size_t i = 0; i < BIN_COUNT; i++)
+            m_bins[i] = 0;
+        m_count = 0;
+        m_overruns = 0;
+        m_min = duration_t(0);
+        m_max = duration_t(0);
+        m_has_prev_wakeup = false;
+    }
+
+    /**
+     * Number of jitter measurements
+     */
+    uint32_t get_count() const noexcept
+    {
+        return m_count;
+    }
+
+    /**
+     * Number of wake ups which were late by more than a whole period
+     */
+    uint32_t get_overruns() const noexcept
+    {
+        return m_overruns;
+    }
+
+    duration_t get_min() const noexcept
+    {
+        return m_min;
+    }
+
+    duration_t get_max() const noexcept
+    {
+        return m_max;
+    }
+
+    /**
+     * Number of measurements in bin `idx`
+     */
+    uint32_t get_bin(size_t idx) const noexcept
+    {
+        return m_bins[idx];
+    }
+
+    /**
+     * Lower edge of bin `idx`
+     */
+    duration_t get_bin_start(size_t idx) const noexcept
+    {
+        return m_bin_width * (static_cast<int>(idx) - static_cast<int>(BIN_COUNT / 2));
+    }
+
+    /**
+     * Jitter below which `percent` of the measurements are
+     * @note Upper edge of the bin where the percentile falls in, limited by min and max
+     */
+    duration_t get_percentile(float percent) const noexcept
+    {
+        const float target = percent / 100.0f * m_count;
+        uint32_t cumulative = 0;
+        for (size_t i = 0; i < BIN_COUNT; i++) {
+            cumulative += m_bins[i];
+            if (cumulative > 0 && cumulative >= target) {
+                /* Last bin is unbounded, so its upper edge is the maximum */
+                const duration_t upper = i + 1 < BIN_COUNT ? get_bin_start(i) + m_bin_width : m_max;
+                return upper < m_min ? m_min : (upper > m_max ? m_max : upper);
+            }
+        }
+        return m_max;
+    }
+
+    /**
+     * Write the summary and all non-empty bins to the logger
+     */
+    template <size_t BUFFER_SIZE>
+    void log(logger<BUFFER_SIZE>& logger, log_level_e level = log_level_e::INFO) const noexcept
+    {
+        logger.log(level,
+            "jitter [us] n=", m_count,
+            " min=", static_cast<int32_t>(m_min.count()),
+            " p50=", static_cast<int32_t>(get_percentile(50).count()),
+            " p99=", static_cast<int32_t>(get_percentile(99).count()),
+            " max=", static_cast<int32_t>(m_max.count()),
+            " overruns=", m_overruns,
+            "\n"
+        );
+        for (size_t i = 0; i < BIN_COUNT; i++) {
+            if (m_bins[i] == 0) {
+                continue;
+            }
+            logger.log(level,
+                "  [", static_cast<int32_t>(get_bin_start(i).count()),
+                ", ", static_cast<int32_t>((get_bin_start(i) + m_bin_width).count()),
+                ") ", m_bins[i],
+                "\n"
+            );
+        }
+    }
+
+private:
+    duration_t m_period;
+    duration_t m_bin_width;
+
+    uint32_t m_bins[BIN_COUNT];
+    uint32_t m_count;
+    uint32_t m_overruns;
+    duration_t m_min;
+    duration_t m_max;
+
+    typename clock_type::time_point m_prev_wakeup;
+    bool m_has_prev_wakeup;
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,97 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/message_buffer.hpp"
+#else
+    #error "Thread implementation missing"
+#endif
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/task.hpp"
+
+namespace emblib::rtos {
+
+/**
+ * Thread-safe FIFO of variable length messages with sending and receiving task blocking
+ * @note Each message uses `sizeof(size_t)` bytes of the capacity for its length. Only
+ * one task (or ISR) can send and only one can receive at a time
+ */
+template <size_t CAPACITY_BYTES>
+class message_buffer {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_message_buffer_t = freertos::message_buffer<CAPACITY_BYTES>;
+#else
+    #error "Message buffer implementation missing"
+#endif
+
+    explicit message_buffer() = default;
+
+    /* Copy operations not allowed */
+    message_buffer(const message_buffer&) = delete;
+    message_buffer& operator=(const message_buffer&) = delete;
+
+    /* Move operations not allowed */
+    message_buffer(message_buffer&&) = delete;
+    message_buffer& operator=(message_buffer&&) = delete;
+
+    /**
+     * Send a message of `size` bytes
+     * @returns `false` if there was no space for the whole message before `timeout`
+     */
+    bool send(const void* data, size_t size, ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Send a message, don't block if there is no space
+     */
+    bool send_from_isr(const void* data, size_t size, isr_context* context = nullptr) noexcept;
+
+    /**
+     * Receive the next message into a buffer of `size` bytes
+     * @returns Length of the message, `0` on timeout or if the
+     * message is longer than the buffer (message is not removed)
+     */
+    size_t receive(void* buffer, size_t size, ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Receive the next message, don't block if there are no messages
+     * @returns Length of the message or `0`
+     */
+    size_t receive_from_isr(void* buffer, size_t size, isr_context* context = nullptr) noexcept;
+
+    /**
+     * Length of the next message, `0` if there are no messages
+     */
+    size_t get_next_size() const noexcept
+    {
+        return m_native_message_buffer.get_next_size();
+    }
+
+    /**
+     * Get reference to the native message buffer object
+     */
+    native_message_buffer_t& get_native_message_buffer() noexcept
+    {
+        return m_native_message_buffer;
+    }
+
+private:
+    native_message_buffer_t m_native_message_buffer;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/message_buffer_inline.hpp"
+#else
+#error "Message buffer implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
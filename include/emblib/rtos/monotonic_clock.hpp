@@ -0,0 +1,71 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/rtos/task.hpp"
+#include "emblib/rtos/timestamp.hpp"
+#include <chrono>
+#if EMBLIB_RTOS_USE_FREERTOS && (defined(__unix__) || defined(__APPLE__))
+    #include <time.h>
+#endif
+
+namespace emblib::rtos {
+
+/**
+ * High resolution monotonic clock for timestamps and short delays
+ *
+ * Meets the standard clock requirements, so it works with `std::chrono`
+ * arithmetic and as the clock of `jitter_histogram`. On hosts it uses the
+ * POSIX (or std) monotonic clock. On targets it uses the FreeRTOS runtime
+ * stats counter, which runs at `RUNTIME_COUNTER_HZ`, and falls back to
+ * the tick count when runtime stats are not generated.
+ */
+class monotonic_clock {
+
+public:
+    using duration = std::chrono::nanoseconds;
+    using rep = duration::rep;
+    using period = duration::period;
+    using time_point = timestamp_t;
+
+    static constexpr bool is_steady = true;
+
+    /**
+     * Current time since an unspecified epoch
+     * @note On targets a 32 bit counter is extended to 64 bits, so this
+     * has to be called at least once per counter period
+     */
+    static time_point now() noexcept;
+
+    /**
+     * Delay the calling task until `deadline` with sub tick precision
+     * @note Whole ticks are slept, so other tasks can run, and only the
+     * rest (less than a tick) is spun on targets without a precise sleep
+     */
+    static void delay_until(time_point deadline) noexcept;
+
+    /**
+     * Delay the calling task for `duration` with sub tick precision
+     */
+    static void delay(duration duration) noexcept
+    {
+        delay_until(now() + duration);
+    }
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/monotonic_clock_inline.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/details/monotonic_clock_inline.hpp"
+#else
+#error "Monotonic clock implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
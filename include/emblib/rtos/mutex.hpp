@@ -3,9 +3,16 @@
 #include "emblib/emblib.hpp"
 #if EMBLIB_RTOS_USE_FREERTOS
     #include "./freertos/semaphore.hpp"
-#else
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/semaphore.hpp"
 #endif
 #include "emblib/rtos/task.hpp"
+#include <algorithm>
+#include <atomic>
+
+#if EMBLIB_RTOS_SUPPORT_MUTEX_STATS && !EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+    #error "Mutex stats need runtime stats"
+#endif
 
 namespace emblib::rtos {
 
@@ -18,10 +25,27 @@ class mutex {
 public:
 #if EMBLIB_RTOS_USE_FREERTOS
     using native_mutex_t = freertos::mutex;
+    using native_counter_t = configRUN_TIME_COUNTER_TYPE;
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    using native_mutex_t = stdthread::mutex;
+    using native_counter_t = uint32_t;
 #else
     #error "Thread implementation missing"
 #endif
 
+#if EMBLIB_RTOS_SUPPORT_MUTEX_STATS
+    /**
+     * Contention stats, times are in runtime stats counter units
+     */
+    struct stats_s {
+        uint32_t lock_count;
+        uint32_t timeout_count;
+        uint64_t total_wait;
+        native_counter_t max_wait;
+        native_counter_t max_hold;
+    };
+#endif
+
     explicit mutex() = default;
 
     /* Copy operations not allowed */
@@ -38,6 +62,15 @@ public:
      */
     bool lock(ticks_t timeout = MAX_TICKS) noexcept;
 
+    /**
+     * Lock only if not already locked
+     * @returns `true` if locked
+     */
+    bool try_lock() noexcept
+    {
+        return lock(ticks_t(0));
+    }
+
     /**
      * Mutex unlock
      * @returns `true` if successful
@@ -52,31 +85,141 @@ public:
         return m_native_mutex;
     }
 
+#if EMBLIB_RTOS_SUPPORT_MUTEX_STATS
+    /**
+     * Stats since construction or the last reset
+     * @note Lock the mutex first for a consistent snapshot
+     */
+    stats_s get_stats() const noexcept
+    {
+        stats_s stats = m_stats;
+        stats.timeout_count = m_timeout_count.load(std::memory_order_relaxed);
+        return stats;
+    }
+
+    /**
+     * Clear the stats
+     * @note Should be called while holding the mutex
+     */
+    void reset_stats() noexcept
+    {
+        m_stats = stats_s();
+        m_timeout_count.store(0, std::memory_order_relaxed);
+    }
+#endif
+
 private:
     native_mutex_t m_native_mutex;
 
+#if EMBLIB_RTOS_SUPPORT_MUTEX_STATS
+    /* Updated only by the task holding the mutex, except for timeouts */
+    stats_s m_stats {};
+    std::atomic<uint32_t> m_timeout_count {0};
+    native_counter_t m_lock_time = 0;
+#endif
+
 };
 
-class scoped_lock {
+/**
+ * Mutex which can be locked again by the task which already holds it
+ * @note Must be unlocked as many times as it was locked
+ * @note Can be used with std guards and locks
+ */
+class recursive_mutex {
+
 public:
-    explicit scoped_lock(mutex& mutex) noexcept :
-        m_mutex(mutex)
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_recursive_mutex_t = freertos::recursive_mutex;
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    using native_recursive_mutex_t = stdthread::recursive_mutex;
+#else
+    #error "Recursive mutex implementation missing"
+#endif
+
+    explicit recursive_mutex() = default;
+
+    /* Copy operations not allowed */
+    recursive_mutex(const recursive_mutex&) = delete;
+    recursive_mutex& operator=(const recursive_mutex&) = delete;
+
+    /* Move operations not allowed */
+    recursive_mutex(recursive_mutex&&) = delete;
+    recursive_mutex& operator=(recursive_mutex&&) = delete;
+
+    /**
+     * Recursive mutex lock
+     * @returns `true` if successful
+     */
+    bool lock(ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Lock only if not held by another task
+     * @returns `true` if locked
+     */
+    bool try_lock() noexcept
+    {
+        return lock(ticks_t(0));
+    }
+
+    /**
+     * Recursive mutex unlock
+     * @returns `true` if successful
+     */
+    bool unlock() noexcept;
+
+    /**
+     * Get reference to the underlying recursive mutex object
+     */
+    native_recursive_mutex_t& get_native_recursive_mutex() noexcept
     {
-        m_mutex.lock();
+        return m_native_recursive_mutex;
     }
 
+private:
+    native_recursive_mutex_t m_native_recursive_mutex;
+
+};
+
+/**
+ * Locks the mutex for the lifetime of the object
+ * @note Check `is_locked` when using a timeout
+ */
+class scoped_lock {
+public:
+    explicit scoped_lock(mutex& mutex, ticks_t timeout = MAX_TICKS) noexcept :
+        m_mutex(mutex),
+        m_is_locked(mutex.lock(timeout))
+    {}
+
     ~scoped_lock() noexcept
     {
-        m_mutex.unlock();
+        if (m_is_locked) {
+            m_mutex.unlock();
+        }
+    }
+
+    /* Copy operations not allowed */
+    scoped_lock(const scoped_lock&) = delete;
+    scoped_lock& operator=(const scoped_lock&) = delete;
+
+    /**
+     * @returns `false` if the lock timed out
+     */
+    bool is_locked() const noexcept
+    {
+        return m_is_locked;
     }
 
 private:
     mutex& m_mutex;
+    bool m_is_locked;
 };
 
 
 #if EMBLIB_RTOS_USE_FREERTOS
     #include "./freertos/details/mutex_inline.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/details/mutex_inline.hpp"
 #else
 #error "Mutex implementation missing"
 #endif
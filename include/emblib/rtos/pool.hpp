@@ -0,0 +1,179 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <atomic>
+#include <cstdint>
+#include <new>
+#include <utility>
+
+namespace emblib::rtos {
+
+/**
+ * Statically allocated pool of `CAPACITY` blocks, each big enough for an `item_type`
+ *
+ * Free blocks are kept in a lock-free list, so allocating and freeing are
+ * O(1), never block and can be called from tasks and ISRs at the same time.
+ * The head of the list is tagged with a counter which is incremented on
+ * every change, so a block which was taken and returned in between can't
+ * corrupt the list (ABA problem).
+ */
+template <typename item_type, size_t CAPACITY>
+class pool {
+
+    using index_t = uint16_t;
+    static constexpr index_t NO_BLOCK = UINT16_MAX;
+
+    static_assert(CAPACITY > 0 && CAPACITY < NO_BLOCK, "Capacity must fit in the block index");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+public:
+    explicit pool() noexcept
+    {
+        for (size_t i = 0; i < CAPACITY; i++)
+            m_next[i].store(i + 1 < CAPACITY ? i + 1 : NO_BLOCK, std::memory_order_relaxed);
+        m_head.store(0, std::memory_order_relaxed);
+    }
+
+    /* Copy operations not allowed */
+    pool(const pool&) = delete;
+    pool& operator=(const pool&) = delete;
+
+    /* Move operations not allowed */
+    pool(pool&&) = delete;
+    pool& operator=(pool&&) = delete;
+
+    /**
+     * Take a block from the pool
+     * @returns Pointer to uninitialized memory or `nullptr` if the pool is exhausted
+     * @note Lock-free, can be called from ISR
+     */
+    void* allocate() noexcept
+    {
+        uint32_t head = m_head.load(std::memory_order_acquire);
+        index_t index;
+        do {
+            index = get_index(head);
+            if (index == NO_BLOCK) {
+                return nullptr;
+            }
+        } while (!m_head.compare_exchange_weak(
+            head,
+            make_head(head, m_next[index].load(std::memory_order_relaxed)),
+            std::memory_order_acquire,
+            std::memory_order_acquire
+        ));
+
+        update_max_used(m_used.fetch_add(1, std::memory_order_relaxed) + 1);
+        return m_blocks[index];
+    }
+
+    /**
+     * Return a block to the pool
+     * @note Block must have been allocated from this pool, `nullptr` is ignored
+     * @note Lock-free, can be called from ISR
+     */
+    void free(void* block) noexcept
+    {
+        if (!block) {
+            return;
+        }
+        const index_t index = (static_cast<uint8_t(*)[sizeof(item_type)]>(block) - m_blocks);
+
+        uint32_t head = m_head.load(std::memory_order_relaxed);
+        do {
+            m_next[index].store(get_index(head), std::memory_order_relaxed);
+        } while (!m_head.compare_exchange_weak(
+            head,
+            make_head(head, index),
+            std::memory_order_release,
+            std::memory_order_relaxed
+        ));
+
+        m_used.fetch_sub(1, std::memory_order_relaxed);
+    }
+
+    /**
+     * Allocate a block and construct an item in it
+     * @returns `nullptr` if the pool is exhausted
+     */
+    template <typename... arg_types>
+    item_type* create(arg_types&&... args) noexcept
+    {
+        void* block = allocate();
+        return block ? new (block) item_type(std::forward<arg_types>(args)...) : nullptr;
+    }
+
+    /**
+     * Destroy an item created with `create` and return its block to the pool
+     * @note `nullptr` is ignored, so the result of a failed `create` can be passed
+     */
+    void destroy(item_type* item) noexcept
+    {
+        if (!item) {
+            return;
+        }
+        item->~item_type();
+        free(item);
+    }
+
+    /**
+     * Number of blocks in the pool
+     */
+    static constexpr size_t get_capacity() noexcept
+    {
+        return CAPACITY;
+    }
+
+    /**
+     * Number of blocks currently allocated
+     */
+    size_t get_used() const noexcept
+    {
+        return m_used.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * Largest number of blocks which were allocated at the same time
+     * @note Use to size the pool for the worst case
+     */
+    size_t get_max_used() const noexcept
+    {
+        return m_max_used.load(std::memory_order_relaxed);
+    }
+
+private:
+    static index_t get_index(uint32_t head) noexcept
+    {
+        return head & NO_BLOCK;
+    }
+
+    /**
+     * New head pointing to `index`, with the tag of the old head incremented
+     */
+    static uint32_t make_head(uint32_t old_head, index_t index) noexcept
+    {
+        return (old_head & ~uint32_t(NO_BLOCK)) + (uint32_t(1) << 16) + index;
+    }
+
+    void update_max_used(size_t used) noexcept
+    {
+        size_t max_used = m_max_used.load(std::memory_order_relaxed);
+        while (used > max_used && !m_max_used.compare_exchange_weak(max_used, used, std::memory_order_relaxed)) {}
+    }
+
+private:
+    alignas(item_type) uint8_t m_blocks[CAPACITY][sizeof(item_type)];
+    std::atomic<index_t> m_next[CAPACITY];
+    std::atomic<uint32_t> m_head;
+    std::atomic<size_t> m_used {0};
+    std::atomic<size_t> m_max_used {0};
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -3,9 +3,12 @@
 #include "emblib/emblib.hpp"
 #if EMBLIB_RTOS_USE_FREERTOS
     #include "./freertos/queue.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/queue.hpp"
 #else
     #error "Thread implementation missing"
 #endif
+#include "emblib/rtos/isr_context.hpp"
 #include "emblib/rtos/task.hpp"
 
 namespace emblib::rtos {
@@ -19,6 +22,8 @@ class queue {
 public:
 #if EMBLIB_RTOS_USE_FREERTOS
     using native_queue_t = freertos::queue<item_type, CAPACITY>;
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    using native_queue_t = stdthread::queue<item_type, CAPACITY>;
 #else
     #error "Queue implementation missing"
 #endif
@@ -41,8 +46,19 @@ public:
 
     /**
      * Send item to the queue, don't block if queue full
+     * @param context Context of the calling interrupt routine, used to
+     * switch to the receiving task on exit if it has a higher priority
      */
-    bool send_from_isr(const item_type& item) noexcept;
+    bool send_from_isr(const item_type& item, isr_context* context = nullptr) noexcept;
+
+    /**
+     * Send up to `count` items to the queue
+     * @returns Number of items sent before `timeout` passed
+     * @note Timeout applies to the whole batch
+     * @note On FreeRTOS each item still goes through the kernel separately,
+     * batching only avoids a context switch to the receiver per item
+     */
+    size_t send_n(const item_type* items, size_t count, ticks_t timeout = MAX_TICKS) noexcept;
 
     /**
      * Receive item from the queue
@@ -50,6 +66,19 @@ public:
      */
     bool receive(item_type& buffer, ticks_t timeout = MAX_TICKS) noexcept;
 
+    /**
+     * Receive item from the queue, don't block if queue empty
+     * @param context Context of the calling interrupt routine
+     */
+    bool receive_from_isr(item_type& buffer, isr_context* context = nullptr) noexcept;
+
+    /**
+     * Wait up to `timeout` for at least one item to be available,
+     * then receive all the available items up to `count`
+     * @returns Number of items received, `0` on timeout
+     */
+    size_t receive_n(item_type* buffer, size_t count, ticks_t timeout = MAX_TICKS) noexcept;
+
     /**
      * Similar to receive, but doesn't remove the item from the queue
      */
@@ -71,6 +100,8 @@ private:
 
 #if EMBLIB_RTOS_USE_FREERTOS
     #include "./freertos/details/queue_inline.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/details/queue_inline.hpp"
 #else
 #error "Mutex implementation missing"
 #endif
@@ -0,0 +1,127 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/queue_set.hpp"
+#else
+    #error "Queue set implementation missing"
+#endif
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/task.hpp"
+
+namespace emblib::rtos {
+
+/**
+ * Set of queues and semaphores which a task can block on all at once
+ *
+ * `select` returns the member which has data, which can then be read
+ * without blocking. Exactly one item must be read from the selected
+ * member for each successful `select`.
+ *
+ * @code
+ * const auto member = set.select();
+ * if (set.is_selected(member, rx_queue)) {
+ *     rx_queue.receive(item, ticks_t(0));
+ * }
+ * @endcode
+ *
+ * @note `CAPACITY` must be at least the sum of the capacities of all the members
+ */
+template <size_t CAPACITY>
+class queue_set {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_queue_set_t = freertos::queue_set<CAPACITY>;
+    using member_t = QueueSetMemberHandle_t;
+#else
+    #error "Queue set implementation missing"
+#endif
+
+    explicit queue_set() = default;
+
+    /* Copy operations not allowed */
+    queue_set(const queue_set&) = delete;
+    queue_set& operator=(const queue_set&) = delete;
+
+    /* Move operations not allowed */
+    queue_set(queue_set&&) = delete;
+    queue_set& operator=(queue_set&&) = delete;
+
+    /**
+     * Add a queue to the set
+     * @note Queue must be empty and not a member of another set
+     */
+    template <typename item_type, size_t QUEUE_CAPACITY>
+    bool add(queue<item_type, QUEUE_CAPACITY>& queue) noexcept;
+
+    /**
+     * Add a semaphore to the set
+     * @note Semaphore must be empty and not a member of another set
+     */
+    bool add(semaphore& semaphore) noexcept;
+
+    /**
+     * Remove a queue from the set
+     * @note Queue must be empty
+     */
+    template <typename item_type, size_t QUEUE_CAPACITY>
+    bool remove(queue<item_type, QUEUE_CAPACITY>& queue) noexcept;
+
+    /**
+     * Remove a semaphore from the set
+     * @note Semaphore must be empty
+     */
+    bool remove(semaphore& semaphore) noexcept;
+
+    /**
+     * Wait until any member has data
+     * @returns Member which has data, or `nullptr` on timeout
+     */
+    member_t select(ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Get the member which has data from an interrupt routine
+     * @returns `nullptr` if no member has data
+     */
+    member_t select_from_isr() noexcept;
+
+    /**
+     * @returns `true` if `member` returned by `select` is the given queue
+     */
+    template <typename item_type, size_t QUEUE_CAPACITY>
+    static bool is_selected(member_t member, queue<item_type, QUEUE_CAPACITY>& queue) noexcept;
+
+    /**
+     * @returns `true` if `member` returned by `select` is the given semaphore
+     */
+    static bool is_selected(member_t member, semaphore& semaphore) noexcept;
+
+    /**
+     * Get reference to the underlying queue set object
+     */
+    native_queue_set_t& get_native_queue_set() noexcept
+    {
+        return m_native_queue_set;
+    }
+
+private:
+    native_queue_set_t m_native_queue_set;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/queue_set_inline.hpp"
+#else
+#error "Queue set implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,86 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/semaphore.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/semaphore.hpp"
+#else
+    #error "Semaphore implementation missing"
+#endif
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/task.hpp"
+
+namespace emblib::rtos {
+
+/**
+ * Counting semaphore, binary if `max_count` is 1
+ * @note Use `mutex` for mutual exclusion, since it has priority inheritance
+ */
+class semaphore {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_semaphore_t = freertos::semaphore;
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    using native_semaphore_t = stdthread::semaphore;
+#else
+    #error "Semaphore implementation missing"
+#endif
+
+    explicit semaphore(size_t max_count = 1, size_t initial_count = 0) noexcept;
+
+    /* Copy operations not allowed */
+    semaphore(const semaphore&) = delete;
+    semaphore& operator=(const semaphore&) = delete;
+
+    /* Move operations not allowed */
+    semaphore(semaphore&&) = delete;
+    semaphore& operator=(semaphore&&) = delete;
+
+    /**
+     * Decrement the count, waiting for it to become positive
+     * @returns `false` on timeout
+     */
+    bool take(ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Increment the count
+     * @returns `false` if already at the maximum count
+     */
+    bool give() noexcept;
+
+    /**
+     * Increment the count from an interrupt routine
+     */
+    bool give_from_isr(isr_context* context = nullptr) noexcept;
+
+    /**
+     * Get reference to the underlying semaphore object
+     */
+    native_semaphore_t& get_native_semaphore() noexcept
+    {
+        return m_native_semaphore;
+    }
+
+private:
+    native_semaphore_t m_native_semaphore;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/semaphore_inline.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/details/semaphore_inline.hpp"
+#else
+#error "Semaphore implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,118 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <atomic>
+#include <cstring>
+#include <type_traits>
+
+namespace emblib::rtos {
+
+/**
+ * Sequence lock for publishing a value to any number of readers
+ *
+ * A single task (or ISR) writes the value without ever waiting. Readers
+ * copy the value and retry if a write happened during the copy, which
+ * is detected by the sequence number being odd or having changed.
+ *
+ * @note A reader which can preempt the writer in the middle of a write
+ * (higher priority task or ISR) must use `try_read`, since `read` would
+ * spin until the writer continues, which it can't on a single core.
+ *
+ * @note Value which is not trivially copyable, like `math::vector3f`, is
+ * copied with its copy assignment, which may see a torn value. It must
+ * only copy the members and not own any resources.
+ */
+template <typename value_type>
+class seqlock {
+
+    static_assert(std::is_copy_assignable_v<value_type>, "Value must be copy assignable");
+    static_assert(std::is_trivially_destructible_v<value_type>, "Value must not own resources");
+    static_assert(std::atomic<uint32_t>::is_always_lock_free);
+
+public:
+    explicit seqlock(const value_type& value = value_type()) noexcept :
+        m_value(value)
+    {}
+
+    /* Copy operations not allowed */
+    seqlock(const seqlock&) = delete;
+    seqlock& operator=(const seqlock&) = delete;
+
+    /* Move operations not allowed */
+    seqlock(seqlock&&) = delete;
+    seqlock& operator=(seqlock&&) = delete;
+
+    /**
+     * Publish a new value
+     * @note Only one task or ISR can write
+     */
+    void write(const value_type& value) noexcept
+    {
+        const uint32_t sequence = m_sequence.load(std::memory_order_relaxed);
+        m_sequence.store(sequence + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+
+        copy(m_value, value);
+
+        m_sequence.store(sequence + 2, std::memory_order_release);
+    }
+
+    /**
+     * Copy the latest value, retrying while it is being written
+     */
+    value_type read() const noexcept
+    {
+        value_type value;
+        while (!try_read(value)) {}
+        return value;
+    }
+
+    /**
+     * Try to copy the latest value once
+     * @returns `false` if a write was in progress, in which case `buffer` may be torn
+     */
+    bool try_read(value_type& buffer) const noexcept
+    {
+        const uint32_t sequence = m_sequence.load(std::memory_order_acquire);
+        if (sequence & 1) {
+            return false;
+        }
+
+        copy(buffer, m_value);
+
+        std::atomic_thread_fence(std::memory_order_acquire);
+        return m_sequence.load(std::memory_order_relaxed) == sequence;
+    }
+
+    /**
+     * Number of writes so far, can be used by readers to detect a new value
+     */
+    uint32_t get_write_count() const noexcept
+    {
+        return m_sequence.load(std::memory_order_acquire) / 2;
+    }
+
+private:
+    static void copy(value_type& destination, const value_type& source) noexcept
+    {
+        if constexpr (std::is_trivially_copyable_v<value_type>) {
+            std::memcpy(&destination, &source, sizeof(value_type));
+        }
+        else {
+            destination = source;
+        }
+    }
+
+private:
+    std::atomic<uint32_t> m_sequence {0};
+    value_type m_value;
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,115 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/rtos/mutex.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/task.hpp"
+#include <atomic>
+
+namespace emblib::rtos {
+
+/**
+ * Reader/writer lock with writer preference
+ *
+ * Any number of readers can hold the lock at the same time, while a
+ * writer holds it alone. A writer holds the inner mutex for as long as
+ * it waits for and holds the lock, and readers take that mutex briefly
+ * to enter. So once a writer is waiting, new readers queue behind it,
+ * and a blocked reader raises the priority of the writer through the
+ * priority inheritance of the mutex. A writer waiting for the readers to
+ * leave does not raise their priority.
+ *
+ * @note Can be used with `std::lock_guard`, `std::unique_lock` and `std::shared_lock`
+ */
+class shared_mutex {
+
+public:
+    explicit shared_mutex() = default;
+
+    /* Copy operations not allowed */
+    shared_mutex(const shared_mutex&) = delete;
+    shared_mutex& operator=(const shared_mutex&) = delete;
+
+    /* Move operations not allowed */
+    shared_mutex(shared_mutex&&) = delete;
+    shared_mutex& operator=(shared_mutex&&) = delete;
+
+    /**
+     * Lock for writing, waiting for the current readers to leave
+     * @returns `false` on timeout
+     * @note Timeout applies to each of the two waits separately
+     */
+    bool lock(ticks_t timeout = MAX_TICKS) noexcept
+    {
+        if (!m_writer_mutex.lock(timeout)) {
+            return false;
+        }
+
+        /* No new readers can enter, last one to leave gives the semaphore */
+        while (m_reader_count.load(std::memory_order_acquire) > 0) {
+            if (!m_readers_done.take(timeout)) {
+                m_writer_mutex.unlock();
+                return false;
+            }
+        }
+        return true;
+    }
+
+    bool try_lock() noexcept
+    {
+        return lock(ticks_t(0));
+    }
+
+    /**
+     * Unlock after writing
+     */
+    bool unlock() noexcept
+    {
+        return m_writer_mutex.unlock();
+    }
+
+    /**
+     * Lock for reading, waiting if a writer holds or waits for the lock
+     * @returns `false` on timeout
+     */
+    bool lock_shared(ticks_t timeout = MAX_TICKS) noexcept
+    {
+        if (!m_writer_mutex.lock(timeout)) {
+            return false;
+        }
+        m_reader_count.fetch_add(1, std::memory_order_acquire);
+        return m_writer_mutex.unlock();
+    }
+
+    bool try_lock_shared() noexcept
+    {
+        return lock_shared(ticks_t(0));
+    }
+
+    /**
+     * Unlock after reading
+     */
+    bool unlock_shared() noexcept
+    {
+        /* Semaphore may be given with no writer waiting, but writers
+         * check the count again after taking it */
+        if (m_reader_count.fetch_sub(1, std::memory_order_release) == 1) {
+            m_readers_done.give();
+        }
+        return true;
+    }
+
+private:
+    mutex m_writer_mutex;
+    semaphore m_readers_done;
+    std::atomic<size_t> m_reader_count {0};
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
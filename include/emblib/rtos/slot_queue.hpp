@@ -0,0 +1,125 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/task.hpp"
+#include <type_traits>
+
+namespace emblib::rtos {
+
+/**
+ * Zero-copy FIFO queue of statically allocated item slots
+ *
+ * Producer acquires a free slot, fills the item in place and commits it.
+ * Consumer receives a pointer to the committed slot and releases it once
+ * done. Only slot indices are passed through the underlying queues, so
+ * large items are never copied.
+ */
+template <typename item_type, size_t CAPACITY>
+class slot_queue {
+
+    static_assert(CAPACITY <= UINT16_MAX);
+
+public:
+    explicit slot_queue() noexcept
+    {
+        for (size_t i = 0; i < CAPACITY; i++) {
+            m_free_slots.send(i, ticks_t(0));
+        }
+    }
+
+    /* Copy operations not allowed */
+    slot_queue(const slot_queue&) = delete;
+    slot_queue& operator=(const slot_queue&) = delete;
+
+    /* Move operations not allowed */
+    slot_queue(slot_queue&&) = delete;
+    slot_queue& operator=(slot_queue&&) = delete;
+
+    /**
+     * Acquire a free slot to write the item into
+     * @returns `nullptr` on timeout
+     */
+    item_type* acquire(ticks_t timeout = MAX_TICKS) noexcept
+    {
+        index_t index;
+        return m_free_slots.receive(index, timeout) ? &m_slots[index] : nullptr;
+    }
+
+    /**
+     * Acquire a free slot from ISR, don't block if none free
+     */
+    item_type* acquire_from_isr(isr_context* context = nullptr) noexcept
+    {
+        index_t index;
+        return m_free_slots.receive_from_isr(index, context) ? &m_slots[index] : nullptr;
+    }
+
+    /**
+     * Append the acquired slot to the queue
+     * @note Never blocks since there are as many indices as slots
+     */
+    bool commit(item_type* slot) noexcept
+    {
+        return m_used_slots.send(get_index(slot), ticks_t(0));
+    }
+
+    /**
+     * Append the acquired slot to the queue from ISR
+     */
+    bool commit_from_isr(item_type* slot, isr_context* context = nullptr) noexcept
+    {
+        return m_used_slots.send_from_isr(get_index(slot), context);
+    }
+
+    /**
+     * Receive the oldest committed slot
+     * @returns `nullptr` on timeout
+     * @note Slot must be returned with `release` once the item is processed
+     */
+    item_type* receive(ticks_t timeout = MAX_TICKS) noexcept
+    {
+        index_t index;
+        return m_used_slots.receive(index, timeout) ? &m_slots[index] : nullptr;
+    }
+
+    /**
+     * Return the received slot so it can be acquired again
+     */
+    bool release(item_type* slot) noexcept
+    {
+        return m_free_slots.send(get_index(slot), ticks_t(0));
+    }
+
+    /**
+     * Return the received slot from ISR
+     */
+    bool release_from_isr(item_type* slot, isr_context* context = nullptr) noexcept
+    {
+        return m_free_slots.send_from_isr(get_index(slot), context);
+    }
+
+private:
+    using index_t = std::conditional_t<(CAPACITY <= UINT8_MAX), uint8_t, uint16_t>;
+
+    index_t get_index(const item_type* slot) const noexcept
+    {
+        assert(slot >= m_slots && slot < m_slots + CAPACITY);
+        return static_cast<index_t>(slot - m_slots);
+    }
+
+private:
+    item_type m_slots[CAPACITY];
+
+    queue<index_t, CAPACITY> m_free_slots;
+    queue<index_t, CAPACITY> m_used_slots;
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
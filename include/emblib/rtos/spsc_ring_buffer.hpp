@@ -0,0 +1,175 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/rtos/task.hpp"
+#include <algorithm>
+#include <atomic>
+
+namespace emblib::rtos {
+
+/**
+ * Lock-free single producer single consumer ring buffer
+ *
+ * Exactly one task (or ISR) can write to the buffer and exactly one task
+ * (or ISR) can read from it, in which case no critical sections are
+ * needed and items are copied in bulk. If the consumer task is set, it is
+ * notified after each successful write, so it can block using
+ * `task::wait_notification` while the buffer is empty.
+ */
+template <typename item_type, size_t CAPACITY>
+class spsc_ring_buffer {
+
+    static_assert(CAPACITY > 0 && (CAPACITY & (CAPACITY - 1)) == 0, "Capacity must be a power of two");
+    static_assert(std::atomic<size_t>::is_always_lock_free);
+
+public:
+    explicit spsc_ring_buffer() = default;
+
+    /* Copy operations not allowed */
+    spsc_ring_buffer(const spsc_ring_buffer&) = delete;
+    spsc_ring_buffer& operator=(const spsc_ring_buffer&) = delete;
+
+    /* Move operations not allowed */
+    spsc_ring_buffer(spsc_ring_buffer&&) = delete;
+    spsc_ring_buffer& operator=(spsc_ring_buffer&&) = delete;
+
+    /**
+     * Set the task which is notified when items are written
+     * @note Should be set before the producer starts writing
+     */
+    void set_consumer(task* consumer) noexcept
+    {
+        m_consumer = consumer;
+    }
+
+    /**
+     * Write up to `count` items to the buffer
+     * @returns Number of items written, less than `count` if the buffer is full
+     */
+    size_t write(const item_type* items, size_t count) noexcept
+    {
+        const size_t written = write_items(items, count);
+        if (written && m_consumer) {
+            m_consumer->notify();
+        }
+        return written;
+    }
+
+    /**
+     * Write a single item to the buffer
+     * @returns `false` if the buffer is full
+     */
+    bool write(const item_type& item) noexcept
+    {
+        return write(&item, 1) == 1;
+    }
+
+    /**
+     * Write up to `count` items to the buffer from ISR
+     * @returns Number of items written, less than `count` if the buffer is full
+     */
+    size_t write_from_isr(const item_type* items, size_t count, isr_context* context = nullptr) noexcept
+    {
+        const size_t written = write_items(items, count);
+        if (written && m_consumer) {
+            m_consumer->notify_from_isr(context);
+        }
+        return written;
+    }
+
+    /**
+     * Write a single item to the buffer from ISR
+     * @returns `false` if the buffer is full
+     */
+    bool write_from_isr(const item_type& item, isr_context* context = nullptr) noexcept
+    {
+        return write_from_isr(&item, 1, context) == 1;
+    }
+
+    /**
+     * Read up to `count` items from the buffer
+     * @returns Number of items read, `0` if the buffer is empty
+     * @note Can be called from both task and ISR context
+     */
+    size_t read(item_type* buffer, size_t count) noexcept
+    {
+        const size_t head = m_head.load(std::memory_order_relaxed);
+        const size_t tail = m_tail.load(std::memory_order_acquire);
+        count = std::min(count, tail - head);
+
+        const size_t begin = head & INDEX_MASK;
+        const size_t first = std::min(count, CAPACITY - begin);
+        std::copy_n(m_storage + begin, first, buffer);
+        std::copy_n(m_storage, count - first, buffer + first);
+
+        m_head.store(head + count, std::memory_order_release);
+        return count;
+    }
+
+    /**
+     * Read a single item from the buffer
+     * @returns `false` if the buffer is empty
+     */
+    bool read(item_type& buffer) noexcept
+    {
+        return read(&buffer, 1) == 1;
+    }
+
+    /**
+     * Number of items currently in the buffer
+     * @note Exact only when called by the producer or the consumer
+     */
+    size_t get_size() const noexcept
+    {
+        return m_tail.load(std::memory_order_acquire) - m_head.load(std::memory_order_acquire);
+    }
+
+    /**
+     * Maximum number of items in the buffer
+     */
+    static constexpr size_t get_capacity() noexcept
+    {
+        return CAPACITY;
+    }
+
+    bool is_empty() const noexcept
+    {
+        return get_size() == 0;
+    }
+
+private:
+    size_t write_items(const item_type* items, size_t count) noexcept
+    {
+        const size_t tail = m_tail.load(std::memory_order_relaxed);
+        const size_t head = m_head.load(std::memory_order_acquire);
+        count = std::min(count, CAPACITY - (tail - head));
+
+        const size_t begin = tail & INDEX_MASK;
+        const size_t first = std::min(count, CAPACITY - begin);
+        std::copy_n(items, first, m_storage + begin);
+        std::copy_n(items + first, count - first, m_storage);
+
+        m_tail.store(tail + count, std::memory_order_release);
+        return count;
+    }
+
+private:
+    static constexpr size_t INDEX_MASK = CAPACITY - 1;
+
+    /* Indices only grow and are masked on access, so they
+     * can wrap around since the capacity is a power of two */
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_head {0};
+    alignas(CACHE_LINE_SIZE) std::atomic<size_t> m_tail {0};
+
+    alignas(CACHE_LINE_SIZE) item_type m_storage[CAPACITY];
+    task* m_consumer = nullptr;
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,16 @@
+#pragma once
+
+inline monotonic_clock::time_point monotonic_clock::now() noexcept
+{
+    const auto since_epoch = std::chrono::steady_clock::now().time_since_epoch();
+    return time_point(std::chrono::duration_cast<duration>(since_epoch));
+}
+
+inline void monotonic_clock::delay_until(time_point deadline) noexcept
+{
+    /* Host sleeps are precise enough, so there is no need to spin */
+    const duration remaining = deadline - now();
+    if (remaining > duration::zero()) {
+        std::this_thread::sleep_for(remaining);
+    }
+}
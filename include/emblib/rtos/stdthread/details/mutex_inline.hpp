@@ -0,0 +1,51 @@
+#pragma once
+
+#if EMBLIB_RTOS_SUPPORT_MUTEX_STATS
+inline bool mutex::lock(ticks_t timeout) noexcept
+{
+    const native_counter_t start = stdthread::get_runtime_counter();
+    if (!m_native_mutex.take(get_native_timeout(timeout))) {
+        m_timeout_count.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    /* Counter differences are correct across wraparound */
+    m_lock_time = stdthread::get_runtime_counter();
+    const native_counter_t wait = m_lock_time - start;
+    m_stats.lock_count++;
+    m_stats.total_wait += wait;
+    m_stats.max_wait = std::max(m_stats.max_wait, wait);
+    return true;
+}
+
+inline bool mutex::unlock() noexcept
+{
+    /* Stats are only touched by the task holding the mutex, before giving it */
+    if (!m_native_mutex.is_held()) {
+        return false;
+    }
+    const native_counter_t hold = stdthread::get_runtime_counter() - m_lock_time;
+    m_stats.max_hold = std::max(m_stats.max_hold, hold);
+    return m_native_mutex.give();
+}
+#else
+inline bool mutex::lock(ticks_t timeout) noexcept
+{
+    return m_native_mutex.take(get_native_timeout(timeout));
+}
+
+inline bool mutex::unlock() noexcept
+{
+    return m_native_mutex.give();
+}
+#endif
+
+inline bool recursive_mutex::lock(ticks_t timeout) noexcept
+{
+    return m_native_recursive_mutex.take(get_native_timeout(timeout));
+}
+
+inline bool recursive_mutex::unlock() noexcept
+{
+    return m_native_recursive_mutex.give();
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+/**
+ * Convert the timeout to a host duration, keeping `MAX_TICKS` as indefinite
+ */
+inline stdthread::duration_t get_native_timeout(ticks_t timeout) noexcept
+{
+    if (timeout == MAX_TICKS) {
+        return stdthread::WAIT_FOREVER;
+    }
+    return std::chrono::duration_cast<stdthread::duration_t>(timeout);
+}
+
+template <size_t STACK_SIZE_BYTES>
+inline task::task(const char *name, size_t priority, task_stack_t<STACK_SIZE_BYTES> &stack) :
+    m_native_task([this] {this->run();}, name, priority)
+{
+    /* Host threads have their own stacks */
+    UNUSED(stack);
+}
+
+inline void task::start_tasks() noexcept
+{
+    stdthread::start_scheduler();
+}
+
+inline void task::stop_tasks() noexcept
+{
+    stdthread::end_scheduler();
+}
+
+inline void task::sleep(ticks_t duration) noexcept
+{
+    if (duration == MAX_TICKS) {
+        while (true) {
+            std::this_thread::sleep_for(std::chrono::hours(1));
+        }
+    }
+    std::this_thread::sleep_for(duration);
+}
+
+inline ticks_t task::get_tick_count() noexcept
+{
+    return std::chrono::duration_cast<ticks_t>(stdthread::scheduler::get_time());
+}
+
+inline ticks_t task::get_ticks_between(ticks_t start, ticks_t end) noexcept
+{
+    /* Host tick count is 64 bit and doesn't wrap */
+    return end - start;
+}
+
+inline bool task::sleep_periodic(ticks_t period) noexcept
+{
+    return m_native_task.sleep_periodic(get_native_timeout(period));
+}
+
+inline size_t task::get_stack_high_water_mark() const noexcept
+{
+    /* Stack buffer is never used by the host thread */
+    return 0;
+}
+
+inline uint32_t task::get_deadline_misses() const noexcept
+{
+    return m_native_task.get_deadline_misses();
+}
+
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+inline uint64_t task::get_runtime_counter() const noexcept
+{
+    return m_native_task.get_runtime_counter();
+}
+#endif
+
+#if EMBLIB_RTOS_SUPPORT_NOTIFICATIONS
+inline bool task::wait_notification(ticks_t timeout) noexcept
+{
+    return m_native_task.wait_notification(get_native_timeout(timeout));
+}
+
+inline void task::notify() noexcept
+{
+    m_native_task.notify();
+}
+
+inline void task::notify_from_isr(isr_context* context) noexcept
+{
+    m_native_task.notify_from_isr(get_native_task_woken(context));
+}
+#endif
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+
+namespace emblib::rtos::stdthread {
+
+/**
+ * Task woken flag for code shared with interrupt routines
+ * @note There are no interrupts on the host, threads are never preempted
+ * by `_from_isr` calls so the flag is never set
+ */
+class isr_context {
+
+public:
+    explicit isr_context() = default;
+
+    /* Copy operations not allowed */
+    isr_context(const isr_context&) = delete;
+    isr_context& operator=(const isr_context&) = delete;
+
+    /* Move operations not allowed */
+    isr_context(isr_context&&) = delete;
+    isr_context& operator=(isr_context&&) = delete;
+
+    bool* get_task_woken() noexcept
+    {
+        return &m_task_woken;
+    }
+
+    bool is_task_woken() const noexcept
+    {
+        return m_task_woken;
+    }
+
+private:
+    bool m_task_woken = false;
+
+};
+
+}
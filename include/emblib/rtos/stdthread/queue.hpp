@@ -0,0 +1,142 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/rtos/stdthread/scheduler.hpp"
+#include <algorithm>
+#include <condition_variable>
+#include <mutex>
+
+namespace emblib::rtos::stdthread {
+
+/**
+ * Host queue with the same semantics as the FreeRTOS queue
+ */
+template <typename item_type, size_t CAPACITY>
+class queue {
+
+public:
+    explicit queue() = default;
+
+    /* Copy operations not allowed */
+    queue(const queue&) = delete;
+    queue& operator=(const queue&) = delete;
+
+    /* Move operations not allowed */
+    queue(queue&&) = delete;
+    queue& operator=(queue&&) = delete;
+
+    /**
+     * Queue send
+     */
+    bool send(const item_type& item, duration_t timeout) noexcept
+    {
+        return send_n(&item, 1, timeout) == 1;
+    }
+
+    /**
+     * Queue send from ISR, never blocks
+     * @param task_woken Not used, there are no interrupts on the host
+     */
+    bool send_from_isr(const item_type& item, bool* task_woken = nullptr) noexcept
+    {
+        UNUSED(task_woken);
+        return send(item, duration_t::zero());
+    }
+
+    /**
+     * Send up to `count` items, blocking while the queue is full
+     * until `timeout` expires for the whole batch
+     * @returns Number of items sent
+     */
+    size_t send_n(const item_type* items, size_t count, duration_t timeout) noexcept
+    {
+        const steady_clock_t::time_point start = steady_clock_t::now();
+        std::unique_lock<std::mutex> lock(m_mutex);
+
+        size_t sent = 0;
+        while (sent < count) {
+            if (!wait_for(m_not_full, lock, get_remaining(start, timeout), [this] {return m_size < CAPACITY;})) {
+                break;
+            }
+            while (sent < count && m_size < CAPACITY) {
+                m_storage[(m_head + m_size) % CAPACITY] = items[sent++];
+                m_size++;
+            }
+            m_not_empty.notify_all();
+        }
+        return sent;
+    }
+
+    /**
+     * Receive item from queue
+     */
+    bool receive(item_type& buffer, duration_t timeout) noexcept
+    {
+        return receive_n(&buffer, 1, timeout) == 1;
+    }
+
+    /**
+     * Receive item from queue from ISR, never blocks
+     */
+    bool receive_from_isr(item_type& buffer, bool* task_woken = nullptr) noexcept
+    {
+        UNUSED(task_woken);
+        return receive(buffer, duration_t::zero());
+    }
+
+    /**
+     * Wait up to `timeout` for at least one item, then receive
+     * all available items up to `count` without blocking
+     * @returns Number of items received
+     */
+    size_t receive_n(item_type* buffer, size_t count, duration_t timeout) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (count == 0 || !wait_for(m_not_empty, lock, timeout, [this] {return m_size > 0;})) {
+            return 0;
+        }
+
+        const size_t received = std::min(count, m_size);
+        for (size_t i = 0; i < received; i++) {
+            buffer[i] = m_storage[m_head];
+            m_head = (m_head + 1) % CAPACITY;
+        }
+        m_size -= received;
+        m_not_full.notify_all();
+        return received;
+    }
+
+    /**
+     * Peek queue
+     */
+    bool peek(item_type& buffer, duration_t timeout) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!wait_for(m_not_empty, lock, timeout, [this] {return m_size > 0;})) {
+            return false;
+        }
+        buffer = m_storage[m_head];
+        return true;
+    }
+
+private:
+    static duration_t get_remaining(steady_clock_t::time_point start, duration_t timeout) noexcept
+    {
+        if (timeout == WAIT_FOREVER) {
+            return WAIT_FOREVER;
+        }
+        return std::max(duration_t::zero(), timeout - (steady_clock_t::now() - start));
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_not_empty;
+    std::condition_variable m_not_full;
+
+    item_type m_storage[CAPACITY];
+    size_t m_head = 0;
+    size_t m_size = 0;
+
+};
+
+}
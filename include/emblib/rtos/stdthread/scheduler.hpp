@@ -0,0 +1,129 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+namespace emblib::rtos::stdthread {
+
+using steady_clock_t = std::chrono::steady_clock;
+using duration_t = steady_clock_t::duration;
+
+/**
+ * Timeout used to signal indefinite waiting
+ */
+static constexpr duration_t WAIT_FOREVER = duration_t::max();
+
+/**
+ * Start gate for the host threads
+ *
+ * Tasks are created as threads right away, but they wait until `start`
+ * is called before running, same as FreeRTOS tasks which are created
+ * before the scheduler starts.
+ * @note Tasks should not be created while the scheduler is running, since
+ * the thread could call `run` before the derived task is constructed
+ */
+class scheduler {
+
+public:
+    /**
+     * Let the tasks run and block until `end` is called
+     */
+    static void start() noexcept
+    {
+        state_s& state = get_state();
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.start_time = steady_clock_t::now();
+        state.is_started = true;
+        state.is_ended = false;
+        state.changed.notify_all();
+        state.changed.wait(lock, [&state] {return state.is_ended;});
+    }
+
+    /**
+     * Return from `start`, tasks which are already running keep running
+     * and tasks created from now on wait for the next `start`
+     */
+    static void end() noexcept
+    {
+        state_s& state = get_state();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        state.is_started = false;
+        state.is_ended = true;
+        state.changed.notify_all();
+    }
+
+    /**
+     * Block the calling thread until the scheduler is started
+     */
+    static void wait_until_started() noexcept
+    {
+        state_s& state = get_state();
+        std::unique_lock<std::mutex> lock(state.mutex);
+        state.changed.wait(lock, [&state] {return state.is_started;});
+    }
+
+    /**
+     * Time since the scheduler started, or since first use if not started yet
+     */
+    static duration_t get_time() noexcept
+    {
+        state_s& state = get_state();
+        std::lock_guard<std::mutex> lock(state.mutex);
+        return steady_clock_t::now() - state.start_time;
+    }
+
+private:
+    struct state_s {
+        std::mutex mutex;
+        std::condition_variable changed;
+        steady_clock_t::time_point start_time = steady_clock_t::now();
+        bool is_started = false;
+        bool is_ended = false;
+    };
+
+    /* Function local so that tasks constructed during static initialization
+     * can use it, and never destroyed since detached task threads can still
+     * be waiting on it when the program exits */
+    static state_s& get_state() noexcept
+    {
+        union storage_u {
+            state_s state;
+            storage_u() : state() {}
+            ~storage_u() {}
+        };
+        static storage_u storage;
+        return storage.state;
+    }
+
+};
+
+/**
+ * Runtime stats counter, microseconds since the scheduler started
+ */
+static inline uint32_t get_runtime_counter() noexcept
+{
+    return static_cast<uint32_t>(std::chrono::duration_cast<std::chrono::microseconds>(scheduler::get_time()).count());
+}
+
+/**
+ * Wait on the condition variable until `predicate` is true or `timeout` passes
+ * @returns Value of `predicate` on return
+ */
+template <typename predicate_type>
+bool wait_for(
+    std::condition_variable& condition,
+    std::unique_lock<std::mutex>& lock,
+    duration_t timeout,
+    predicate_type predicate
+) noexcept
+{
+    if (timeout == WAIT_FOREVER) {
+        condition.wait(lock, predicate);
+        return true;
+    }
+    return condition.wait_for(lock, timeout, predicate);
+}
+
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/rtos/stdthread/scheduler.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+
+namespace emblib::rtos::stdthread {
+
+/**
+ * Host counting semaphore
+ */
+class semaphore {
+
+public:
+    explicit semaphore(size_t max_count = 1, size_t initial_count = 0) noexcept :
+        m_count(initial_count),
+        m_max_count(max_count)
+    {}
+
+    /* Copy operations not allowed */
+    semaphore(const semaphore&) = delete;
+    semaphore& operator=(const semaphore&) = delete;
+
+    /* Move operations not allowed */
+    semaphore(semaphore&&) = delete;
+    semaphore& operator=(semaphore&&) = delete;
+
+    bool take(duration_t timeout) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_mutex);
+        if (!wait_for(m_available, lock, timeout, [this] {return m_count > 0;})) {
+            return false;
+        }
+        m_count--;
+        return true;
+    }
+
+    bool give() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if (m_count >= m_max_count) {
+            return false;
+        }
+        m_count++;
+        m_available.notify_one();
+        return true;
+    }
+
+    /**
+     * @param task_woken Not used, there are no interrupts on the host
+     */
+    bool give_from_isr(bool* task_woken = nullptr) noexcept
+    {
+        UNUSED(task_woken);
+        return give();
+    }
+
+private:
+    std::mutex m_mutex;
+    std::condition_variable m_available;
+    size_t m_count;
+    size_t m_max_count;
+
+};
+
+
+/**
+ * Host mutex, no priority inheritance
+ */
+class mutex {
+
+public:
+    explicit mutex() = default;
+
+    /* Copy operations not allowed */
+    mutex(const mutex&) = delete;
+    mutex& operator=(const mutex&) = delete;
+
+    /* Move operations not allowed */
+    mutex(mutex&&) = delete;
+    mutex& operator=(mutex&&) = delete;
+
+    /**
+     * @returns `false` if the calling thread already holds the mutex,
+     * since it would wait for itself, which on FreeRTOS times out
+     */
+    bool take(duration_t timeout) noexcept
+    {
+        if (is_held()) {
+            return false;
+        }
+        if (timeout == WAIT_FOREVER) {
+            m_mutex.lock();
+        }
+        else if (!m_mutex.try_lock_for(timeout)) {
+            return false;
+        }
+        m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        return true;
+    }
+
+    /**
+     * @returns `false` if the calling thread doesn't hold the mutex, same as FreeRTOS
+     */
+    bool give() noexcept
+    {
+        if (!is_held()) {
+            return false;
+        }
+        m_owner.store(std::thread::id(), std::memory_order_relaxed);
+        m_mutex.unlock();
+        return true;
+    }
+
+    /**
+     * Check if the calling thread holds the mutex
+     */
+    bool is_held() const noexcept
+    {
+        return m_owner.load(std::memory_order_relaxed) == std::this_thread::get_id();
+    }
+
+private:
+    std::timed_mutex m_mutex;
+    std::atomic<std::thread::id> m_owner {};
+
+};
+
+
+/**
+ * Host recursive mutex
+ * @note Must be given as many times as it was taken
+ */
+class recursive_mutex {
+
+public:
+    explicit recursive_mutex() = default;
+
+    /* Copy operations not allowed */
+    recursive_mutex(const recursive_mutex&) = delete;
+    recursive_mutex& operator=(const recursive_mutex&) = delete;
+
+    /* Move operations not allowed */
+    recursive_mutex(recursive_mutex&&) = delete;
+    recursive_mutex& operator=(recursive_mutex&&) = delete;
+
+    bool take(duration_t timeout) noexcept
+    {
+        if (timeout == WAIT_FOREVER) {
+            m_mutex.lock();
+        }
+        else if (!m_mutex.try_lock_for(timeout)) {
+            return false;
+        }
+        if (m_depth++ == 0) {
+            m_owner.store(std::this_thread::get_id(), std::memory_order_relaxed);
+        }
+        return true;
+    }
+
+    /**
+     * @returns `false` if the calling thread doesn't hold the mutex, same as FreeRTOS
+     */
+    bool give() noexcept
+    {
+        if (m_owner.load(std::memory_order_relaxed) != std::this_thread::get_id()) {
+            return false;
+        }
+        if (--m_depth == 0) {
+            m_owner.store(std::thread::id(), std::memory_order_relaxed);
+        }
+        m_mutex.unlock();
+        return true;
+    }
+
+private:
+    std::recursive_timed_mutex m_mutex;
+    std::atomic<std::thread::id> m_owner {};
+
+    /* Changed only by the owner while holding the mutex */
+    size_t m_depth = 0;
+
+};
+
+}
@@ -0,0 +1,184 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include "emblib/common/inplace_function.hpp"
+#include "emblib/rtos/stdthread/scheduler.hpp"
+#include <atomic>
+#include <condition_variable>
+#include <mutex>
+#include <thread>
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+    #include <pthread.h>
+    #include <time.h>
+#endif
+
+namespace emblib::rtos::stdthread {
+
+/**
+ * Start the host scheduler, returns only after `end_scheduler`
+ */
+static inline void start_scheduler() noexcept
+{
+    scheduler::start();
+}
+
+/**
+ * Make `start_scheduler` return
+ */
+static inline void end_scheduler() noexcept
+{
+    scheduler::end();
+}
+
+/**
+ * Task running on a host thread
+ *
+ * All tasks run in parallel on the available cores, so priorities are
+ * only stored and code must not rely on a higher priority task excluding
+ * lower priority ones. The thread is detached, so the task object must
+ * outlive it, same as a FreeRTOS task which never exits.
+ */
+class task {
+
+public:
+    explicit task(inplace_function<void ()> task_func, const char* name, size_t priority) :
+        m_task_func(std::move(task_func)),
+        m_name(name),
+        m_priority(priority),
+        m_thread(&task_entry, this)
+    {
+        m_thread.detach();
+    }
+
+    /* Copy operations not allowed */
+    task(const task&) = delete;
+    task& operator=(const task&) = delete;
+
+    /* Move operations not allowed */
+    task(task&&) = delete;
+    task& operator=(task&&) = delete;
+
+    /**
+     * Sleep relative to previous wake up time
+     * @returns `true` if the task was delayed, `false` if the next wake
+     * up time already passed, which is counted as a deadline miss
+     */
+    bool sleep_periodic(duration_t period) noexcept
+    {
+        if (m_first_period) {
+            m_first_period = false;
+            m_prev_wakeup = steady_clock_t::now();
+        }
+
+        /* Same as FreeRTOS, the next period is relative to the missed wake up time */
+        m_prev_wakeup += period;
+        if (m_prev_wakeup <= steady_clock_t::now()) {
+            m_deadline_misses++;
+            return false;
+        }
+        std::this_thread::sleep_until(m_prev_wakeup);
+        return true;
+    }
+
+    /**
+     * Number of times `sleep_periodic` was called after the wake up time already passed
+     */
+    uint32_t get_deadline_misses() const noexcept
+    {
+        return m_deadline_misses;
+    }
+
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+    /**
+     * CPU time used by the thread in microseconds
+     * @note Uses POSIX thread CPU clocks, `0` before the task starts running
+     */
+    uint64_t get_runtime_counter() const noexcept
+    {
+        timespec time;
+        if (!m_is_clock_valid.load(std::memory_order_acquire) || clock_gettime(m_cpu_clock, &time) != 0) {
+            return 0;
+        }
+        return static_cast<uint64_t>(time.tv_sec) * 1000000 + time.tv_nsec / 1000;
+    }
+#endif
+
+    /**
+     * Increment task's notification value (works like a counting semaphore)
+     */
+    void notify() noexcept
+    {
+        std::lock_guard<std::mutex> lock(m_notification_mutex);
+        m_notification_count++;
+        m_notified.notify_one();
+    }
+
+    /**
+     * Increment task's notification value
+     * @param task_woken Not used, there are no interrupts on the host
+     */
+    void notify_from_isr(bool* task_woken = nullptr) noexcept
+    {
+        UNUSED(task_woken);
+        notify();
+    }
+
+    /**
+     * Wait for the notification value to become positive and decrement it
+     * @note Must be called only by this task
+     */
+    bool wait_notification(duration_t timeout) noexcept
+    {
+        std::unique_lock<std::mutex> lock(m_notification_mutex);
+        if (!wait_for(m_notified, lock, timeout, [this] {return m_notification_count > 0;})) {
+            return false;
+        }
+        m_notification_count--;
+        return true;
+    }
+
+    const char* get_name() const noexcept
+    {
+        return m_name;
+    }
+
+    size_t get_priority() const noexcept
+    {
+        return m_priority;
+    }
+
+private:
+    static void task_entry(task* instance) noexcept
+    {
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+        if (pthread_getcpuclockid(pthread_self(), &instance->m_cpu_clock) == 0) {
+            instance->m_is_clock_valid.store(true, std::memory_order_release);
+        }
+#endif
+        scheduler::wait_until_started();
+        instance->m_task_func();
+    }
+
+private:
+    inplace_function<void ()> m_task_func;
+    const char* m_name;
+    size_t m_priority;
+
+    std::mutex m_notification_mutex;
+    std::condition_variable m_notified;
+    uint32_t m_notification_count = 0;
+
+    steady_clock_t::time_point m_prev_wakeup;
+    bool m_first_period = true;
+    uint32_t m_deadline_misses = 0;
+
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+    clockid_t m_cpu_clock;
+    std::atomic<bool> m_is_clock_valid {false};
+#endif
+
+    /* Started last, once all the other members are initialized */
+    std::thread m_thread;
+};
+
+}
@@ -0,0 +1,104 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/stream_buffer.hpp"
+#else
+    #error "Thread implementation missing"
+#endif
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/task.hpp"
+
+namespace emblib::rtos {
+
+/**
+ * Thread-safe byte stream with sending and receiving task blocking
+ * @note Only one task (or ISR) can send and only one can receive
+ * at a time, use a mutex if there are multiple writers or readers
+ */
+template <size_t CAPACITY_BYTES>
+class stream_buffer {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_stream_buffer_t = freertos::stream_buffer<CAPACITY_BYTES>;
+#else
+    #error "Stream buffer implementation missing"
+#endif
+
+    /**
+     * @param trigger_level Number of bytes which need to be
+     * available to unblock a task waiting to receive
+     */
+    explicit stream_buffer(size_t trigger_level = 1) noexcept :
+        m_native_stream_buffer(trigger_level)
+    {}
+
+    /* Copy operations not allowed */
+    stream_buffer(const stream_buffer&) = delete;
+    stream_buffer& operator=(const stream_buffer&) = delete;
+
+    /* Move operations not allowed */
+    stream_buffer(stream_buffer&&) = delete;
+    stream_buffer& operator=(stream_buffer&&) = delete;
+
+    /**
+     * Send up to `size` bytes to the stream
+     * @returns Number of bytes sent before `timeout` passed
+     */
+    size_t send(const void* data, size_t size, ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Send bytes to the stream, don't block if stream full
+     * @returns Number of bytes sent
+     */
+    size_t send_from_isr(const void* data, size_t size, isr_context* context = nullptr) noexcept;
+
+    /**
+     * Wait up to `timeout` for the trigger level to be reached,
+     * then receive up to `size` bytes
+     * @returns Number of bytes received
+     */
+    size_t receive(void* buffer, size_t size, ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Receive up to `size` bytes, don't block if stream empty
+     * @returns Number of bytes received
+     */
+    size_t receive_from_isr(void* buffer, size_t size, isr_context* context = nullptr) noexcept;
+
+    /**
+     * Number of bytes available to receive
+     */
+    size_t get_available() const noexcept
+    {
+        return m_native_stream_buffer.get_available();
+    }
+
+    /**
+     * Get reference to the native stream buffer object
+     */
+    native_stream_buffer_t& get_native_stream_buffer() noexcept
+    {
+        return m_native_stream_buffer;
+    }
+
+private:
+    native_stream_buffer_t m_native_stream_buffer;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/stream_buffer_inline.hpp"
+#else
+#error "Stream buffer implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -3,8 +3,10 @@
 #include "emblib/emblib.hpp"
 #if EMBLIB_RTOS_USE_FREERTOS
     #include "./freertos/task.hpp"
-#else
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/task.hpp"
 #endif
+#include "emblib/rtos/isr_context.hpp"
 #include <chrono>
 
 namespace emblib::rtos {
@@ -17,10 +19,13 @@ using task_stack_t = uint8_t[SIZE_IN_BYTES];
 
 /**
  * Duration of a period of time in number of ticks
- * @note Duration of a single tick is defined in emblib_config.hpp
+ * @note Tick rate is defined in emblib_config.hpp, durations which are
+ * exact multiples of a tick convert implicitly, others need `to_ticks`
  */
 using ticks_t =
-#if EMBLIB_RTOS_TICK_MILLIS
+#if defined(EMBLIB_RTOS_TICK_RATE_HZ)
+    std::chrono::duration<int64_t, std::ratio<1, EMBLIB_RTOS_TICK_RATE_HZ>>;
+#elif EMBLIB_RTOS_TICK_MILLIS
     std::chrono::milliseconds;
 #else
     #error "Ticks not defined"
@@ -31,6 +36,16 @@ using ticks_t =
  */
 static constexpr ticks_t MAX_TICKS = ticks_t(-1);
 
+/**
+ * Convert any duration to ticks, rounding up so that
+ * a timeout or a delay is never shorter than requested
+ */
+template <typename rep_type, typename period_type>
+constexpr ticks_t to_ticks(std::chrono::duration<rep_type, period_type> duration) noexcept
+{
+    return std::chrono::ceil<ticks_t>(duration);
+}
+
 
 /**
  * Thread interface
@@ -40,6 +55,8 @@ class task {
 public:
 #if EMBLIB_RTOS_USE_FREERTOS
     using native_task_t = freertos::task;
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    using native_task_t = stdthread::task;
 #else
     #error "Task implementation missing"
 #endif
@@ -66,12 +83,31 @@ public:
      */
     static inline void start_tasks() noexcept;
 
+    /**
+     * Stop the scheduler, making `start_tasks` return
+     * @note Supported only by some ports, such as the FreeRTOS POSIX
+     * port and the std::thread backend, used by host side tests
+     */
+    static inline void stop_tasks() noexcept;
+
     /**
      * Put the currently running thread to sleep
      * @note Static since can be called even baremetal and implemented using HAL
      */
     static inline void sleep(ticks_t duration) noexcept;
 
+    /**
+     * Number of ticks since the scheduler started
+     */
+    static inline ticks_t get_tick_count() noexcept;
+
+    /**
+     * Ticks from `start` to `end`, both returned by `get_tick_count`
+     * @note Correct across the wraparound of the native tick count, as
+     * long as less than a whole wraparound period passed between them
+     */
+    static inline ticks_t get_ticks_between(ticks_t start, ticks_t end) noexcept;
+
 #if EMBLIB_RTOS_SUPPORT_NOTIFICATIONS
     /**
      * Increment this task's notification value
@@ -81,9 +117,29 @@ public:
 
     /**
      * Increment this task's notification value from ISR
+     * @param context Context of the calling interrupt routine, used to
+     * switch to this task on exit if it has a higher priority
      * @note Unblocks this task if is currently waiting on notification
      */
-    void notify_from_isr() noexcept;
+    void notify_from_isr(isr_context* context = nullptr) noexcept;
+#endif
+
+    /**
+     * Minimum amount of free stack space since the task started, in bytes
+     * @note Use to size the task stack
+     */
+    size_t get_stack_high_water_mark() const noexcept;
+
+    /**
+     * Number of times `sleep_periodic` was called after the next wake up time already passed
+     */
+    uint32_t get_deadline_misses() const noexcept;
+
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+    /**
+     * Total time spent running this task, in units of the runtime stats counter
+     */
+    uint64_t get_runtime_counter() const noexcept;
 #endif
 
     /**
@@ -97,10 +153,10 @@ public:
 protected:
     /**
      * Put this task to sleep until (last wake up time from this method + period)
+     * @returns `false` if the wake up time already passed when called (deadline missed)
      * @note First time this is called, next wake up time is relative to task creation
-     * @todo Can change return type to bool to signal if woke up on time
      */
-    void sleep_periodic(ticks_t period) noexcept;
+    bool sleep_periodic(ticks_t period) noexcept;
 
 #if EMBLIB_RTOS_SUPPORT_NOTIFICATIONS
     /**
@@ -125,6 +181,8 @@ private:
 
 #if EMBLIB_RTOS_USE_FREERTOS
     #include "./freertos/details/task_inline.hpp"
+#elif EMBLIB_RTOS_USE_STD_THREAD
+    #include "./stdthread/details/task_inline.hpp"
 #else
     #error "Thread implementation missing"
 #endif
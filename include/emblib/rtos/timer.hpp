@@ -0,0 +1,118 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/timer.hpp"
+#else
+    #error "Timer implementation missing"
+#endif
+#include "emblib/common/inplace_function.hpp"
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/task.hpp"
+
+namespace emblib::rtos {
+
+/**
+ * Software timer
+ *
+ * All timers share a single timer daemon task which calls the callbacks,
+ * so periodic jobs don't need their own task and stack. Callbacks run
+ * one after another, so they must be short and must never block.
+ * Commands (start, stop...) are sent to the daemon task through a
+ * queue, where the timeout is the time to wait for space in that queue.
+ */
+class timer {
+
+public:
+#if EMBLIB_RTOS_USE_FREERTOS
+    using native_timer_t = freertos::timer;
+#else
+    #error "Timer implementation missing"
+#endif
+
+    enum class mode_e {ONE_SHOT, PERIODIC};
+
+    /* Typedef of the timer callback */
+    using callback_t = inplace_function<void ()>;
+
+    explicit timer(const char* name, ticks_t period, mode_e mode, callback_t callback) noexcept;
+
+    /* Copy operations not allowed */
+    timer(const timer&) = delete;
+    timer& operator=(const timer&) = delete;
+
+    /* Move operations not allowed */
+    timer(timer&&) = delete;
+    timer& operator=(timer&&) = delete;
+
+    /**
+     * Start the timer, callback is called one period after this
+     * @returns `false` if the command could not be sent before `timeout`
+     */
+    bool start(ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Start the timer from an interrupt routine
+     */
+    bool start_from_isr(isr_context* context = nullptr) noexcept;
+
+    /**
+     * Stop the timer
+     */
+    bool stop(ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Stop the timer from an interrupt routine
+     */
+    bool stop_from_isr(isr_context* context = nullptr) noexcept;
+
+    /**
+     * Restart the period from now, starting the timer if it is stopped
+     * @note Can be used as a watchdog which expires if not reset in time
+     */
+    bool reset(ticks_t timeout = MAX_TICKS) noexcept;
+
+    /**
+     * Restart the period from an interrupt routine
+     */
+    bool reset_from_isr(isr_context* context = nullptr) noexcept;
+
+    /**
+     * Change the period, starting the timer if it is stopped
+     */
+    bool set_period(ticks_t period, ticks_t timeout = MAX_TICKS) noexcept;
+
+    ticks_t get_period() const noexcept;
+
+    /**
+     * @returns `true` if the timer is running
+     */
+    bool is_active() const noexcept;
+
+    /**
+     * Get reference to the underlying implementation object
+     */
+    native_timer_t& get_native_timer() noexcept
+    {
+        return m_native_timer;
+    }
+
+private:
+    native_timer_t m_native_timer;
+
+};
+
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    #include "./freertos/details/timer_inline.hpp"
+#else
+#error "Timer implementation missing"
+#endif
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -0,0 +1,24 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <chrono>
+
+namespace emblib::rtos {
+
+class monotonic_clock;
+
+/**
+ * Time point of the `monotonic_clock`
+ *
+ * Declared apart from the clock, so that drivers can store timestamps
+ * without including the clock implementation and the RTOS with it.
+ */
+using timestamp_t = std::chrono::time_point<monotonic_clock, std::chrono::nanoseconds>;
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
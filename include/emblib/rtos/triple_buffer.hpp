@@ -0,0 +1,103 @@
+#pragma once
+
+#include "emblib/emblib.hpp"
+#include <atomic>
+#include <type_traits>
+
+namespace emblib::rtos {
+
+/**
+ * Latest value buffer between a single writer and a single reader
+ *
+ * The writer fills one slot and swaps it with the middle slot, and the
+ * reader swaps its slot with the middle one when there is a new value.
+ * Both sides never wait or retry, regardless of their priorities, and the
+ * reader always sees a complete value. Values written before the reader
+ * gets to them are dropped, only the latest one is kept.
+ *
+ * @note Use `seqlock` when the value has more than one reader
+ */
+template <typename value_type>
+class triple_buffer {
+
+    static_assert(std::is_copy_assignable_v<value_type>, "Value must be copy assignable");
+    static_assert(std::atomic<uint8_t>::is_always_lock_free);
+
+public:
+    explicit triple_buffer(const value_type& value = value_type()) noexcept :
+        m_slots{value, value, value}
+    {}
+
+    /* Copy operations not allowed */
+    triple_buffer(const triple_buffer&) = delete;
+    triple_buffer& operator=(const triple_buffer&) = delete;
+
+    /* Move operations not allowed */
+    triple_buffer(triple_buffer&&) = delete;
+    triple_buffer& operator=(triple_buffer&&) = delete;
+
+    /**
+     * Publish a new value
+     * @note Can be called from both task and ISR context
+     */
+    void write(const value_type& value) noexcept
+    {
+        m_slots[m_write_index] = value;
+        const uint8_t previous = m_middle.exchange(m_write_index | NEW_VALUE, std::memory_order_acq_rel);
+        m_write_index = previous & INDEX_MASK;
+    }
+
+    /**
+     * Get the latest value, swapping in the new one if it was written
+     * @returns `true` if the value is new since the last read
+     * @note Can be called from both task and ISR context
+     */
+    bool read(value_type& buffer) noexcept
+    {
+        const bool is_new = update();
+        buffer = m_slots[m_read_index];
+        return is_new;
+    }
+
+    /**
+     * Swap in the latest value if it was written
+     * @returns `true` if the value is new since the last update
+     */
+    bool update() noexcept
+    {
+        if (!(m_middle.load(std::memory_order_relaxed) & NEW_VALUE)) {
+            return false;
+        }
+        const uint8_t previous = m_middle.exchange(m_read_index, std::memory_order_acq_rel);
+        m_read_index = previous & INDEX_MASK;
+        return true;
+    }
+
+    /**
+     * Value as of the last `update` or `read`, valid until the next one
+     */
+    const value_type& get() const noexcept
+    {
+        return m_slots[m_read_index];
+    }
+
+private:
+    static constexpr uint8_t INDEX_MASK = 0x03;
+    static constexpr uint8_t NEW_VALUE = 0x04;
+
+    value_type m_slots[3];
+
+    /* Each slot is owned by the writer, the reader or is in the middle */
+    alignas(CACHE_LINE_SIZE) uint8_t m_write_index = 0;
+    alignas(CACHE_LINE_SIZE) std::atomic<uint8_t> m_middle {1};
+    alignas(CACHE_LINE_SIZE) uint8_t m_read_index = 2;
+
+};
+
+}
+
+#if EMBLIB_UNNEST_NAMESPACES
+namespace emblib {
+    using namespace rtos;
+}
+#endif
@@ -4,13 +4,34 @@
 
 #define EMBLIB_CHAR_DEV_SUPPORT_ETL 1
 
+/* RTOS backend can be overriden from the command line, the std::thread
+ * backend runs tasks on host threads (task, queue, mutex and semaphore) */
+#ifndef EMBLIB_RTOS_USE_FREERTOS
 #define EMBLIB_RTOS_USE_FREERTOS    1
+#endif
+#ifndef EMBLIB_RTOS_USE_STD_THREAD
+#define EMBLIB_RTOS_USE_STD_THREAD  0
+#endif
 #define EMBLIB_RTOS_USE_THREADX     0
-#define EMBLIB_RTOS_TICK_MILLIS     1
+/* Must match configTICK_RATE_HZ when using FreeRTOS */
+#define EMBLIB_RTOS_TICK_RATE_HZ    1000
 #define EMBLIB_RTOS_SUPPORT_NOTIFICATIONS 1
+/* Runtime stats need configGENERATE_RUN_TIME_STATS when using FreeRTOS */
+#ifndef EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+#define EMBLIB_RTOS_SUPPORT_RUNTIME_STATS 1
+#endif
+/* Mutex stats can be overriden from the command line (used by tests) */
+#ifndef EMBLIB_RTOS_SUPPORT_MUTEX_STATS
+#define EMBLIB_RTOS_SUPPORT_MUTEX_STATS 0
+#endif
 
+/* Math backend can be overriden from the command line (used by benchmarks) */
+#ifndef EMBLIB_MATH_USE_GLM
 #define EMBLIB_MATH_USE_GLM         0
+#endif
+#ifndef EMBLIB_MATH_USE_EIGEN
 #define EMBLIB_MATH_USE_EIGEN       1
+#endif
 
 namespace emblib {
 
@@ -19,4 +40,29 @@ namespace emblib {
  */
 static constexpr int I2C_MUX_MAX_CHANNELS = 8;
 
+/**
+ * Default storage size in bytes for callables in inplace_function,
+ * enough for a lambda capturing a few pointers
+ */
+static constexpr int INPLACE_FUNCTION_CAPACITY = 4 * sizeof(void*);
+
+/**
+ * Frequency of the FreeRTOS runtime stats counter, used by
+ * monotonic_clock on targets without a POSIX clock
+ */
+static constexpr int RUNTIME_COUNTER_HZ = 1000000;
+
+/**
+ * Statically allocated coroutine frames, a coroutine whose
+ * frame is larger than the frame size fails to spawn
+ */
+static constexpr int COROUTINE_FRAME_SIZE = 512;
+static constexpr int COROUTINE_FRAME_COUNT = 16;
+
+/**
+ * Size of the data cache line, used to keep data written
+ * by different cores (or tasks) in separate cache lines
+ */
+static constexpr int CACHE_LINE_SIZE = 64;
+
 }
\ No newline at end of file
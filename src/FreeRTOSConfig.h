@@ -46,7 +46,7 @@
 #define configMINIMAL_STACK_SIZE                   ( ( unsigned short ) 128 ) /* The stack size being passed is equal to the minimum stack size needed by pthread_create(). */
 // #define configTOTAL_HEAP_SIZE                      ( ( size_t ) ( 65 * 1024 ) )
 #define configMAX_TASK_NAME_LEN                    ( 16 )
-#define configUSE_TRACE_FACILITY                   0
+#define configUSE_TRACE_FACILITY                   1
 #define configUSE_16_BIT_TICKS                     0
 #define configIDLE_SHOULD_YIELD                    1
 #define configUSE_MUTEXES                          1
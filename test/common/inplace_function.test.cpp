@@ -0,0 +1,46 @@
+#include "emblib/common/inplace_function.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("Inplace function test", "[common][inplace_function]")
+{
+    int calls = 0;
+    emblib::inplace_function<int(int)> func = [&calls](int value) {
+        calls++;
+        return value * 2;
+    };
+
+    REQUIRE(func);
+    REQUIRE(func(3) == 6);
+
+    emblib::inplace_function<int(int)> copy = func;
+    REQUIRE(copy(4) == 8);
+    REQUIRE(calls == 2);
+
+    emblib::inplace_function<int(int)> moved = std::move(copy);
+    REQUIRE(moved(5) == 10);
+
+    moved = nullptr;
+    REQUIRE_FALSE(moved);
+    REQUIRE_FALSE(emblib::inplace_function<void()>());
+}
+
+TEST_CASE("Inplace function capture lifetime test", "[common][inplace_function]")
+{
+    struct counted_s {
+        counted_s(int& count) : count(count) { count++; }
+        counted_s(const counted_s& other) : count(other.count) { count++; }
+        ~counted_s() { count--; }
+        void operator()() const {}
+        int& count;
+    };
+
+    int alive = 0;
+    {
+        emblib::inplace_function<void()> func = counted_s(alive);
+        emblib::inplace_function<void()> copy = func;
+        REQUIRE(alive == 2);
+        copy = func;
+        REQUIRE(alive == 2);
+    }
+    REQUIRE(alive == 0);
+}
@@ -0,0 +1,167 @@
+#include "emblib/driver/async_sensor_reader.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+namespace {
+
+/**
+ * Pin which keeps the interrupt callback so the test can trigger it
+ */
+class fake_pin : public emblib::driver::gpio_pin {
+public:
+    bool read(bool& state) noexcept override
+    {
+        state = false;
+        return true;
+    }
+
+    bool write(bool state) noexcept override
+    {
+        UNUSED(state);
+        return true;
+    }
+
+    bool toggle() noexcept override
+    {
+        return true;
+    }
+
+    bool set_mode(mode_e mode) noexcept override
+    {
+        UNUSED(mode);
+        return true;
+    }
+
+    bool set_pull(pull_e pull) noexcept override
+    {
+        UNUSED(pull);
+        return true;
+    }
+
+    bool set_intr(intr_e intr, intr_callback_t callback) noexcept override
+    {
+        UNUSED(intr);
+        m_callback = callback;
+        return true;
+    }
+
+    void trigger() noexcept
+    {
+        if (m_callback) {
+            m_callback();
+        }
+    }
+
+private:
+    intr_callback_t m_callback;
+};
+
+/**
+ * Device which completes a transfer only when `complete` is called,
+ * reading back an incrementing value in each byte
+ */
+class fake_device : public emblib::driver::char_dev {
+public:
+    ssize_t write(const char* data, size_t size, emblib::milliseconds timeout) noexcept override
+    {
+        UNUSED(data);
+        UNUSED(timeout);
+        return size;
+    }
+
+    ssize_t read(char* buffer, size_t size, emblib::milliseconds timeout) noexcept override
+    {
+        UNUSED(buffer);
+        UNUSED(timeout);
+        return size;
+    }
+
+    bool write_async(const char* data, size_t size, const callback_t cb) noexcept override
+    {
+        m_register = *data;
+        m_size = size;
+        m_callback = cb;
+        return true;
+    }
+
+    bool read_async(char* buffer, size_t size, const callback_t cb) noexcept override
+    {
+        m_value++;
+        std::fill_n(buffer, size, m_value);
+        m_size = size;
+        m_callback = cb;
+        return true;
+    }
+
+    bool is_async_available() noexcept override
+    {
+        return true;
+    }
+
+    void complete(bool success = true) noexcept
+    {
+        callback_t callback = m_callback;
+        m_callback.reset();
+        callback(success ? ssize_t(m_size) : ssize_t(-1));
+    }
+
+    char m_register = 0;
+
+private:
+    callback_t m_callback;
+    size_t m_size = 0;
+    char m_value = 0;
+};
+
+}
+
+TEST_CASE("Async sensor reader test", "[driver][async_sensor_reader]")
+{
+    fake_pin pin;
+    fake_device device;
+    emblib::driver::async_sensor_reader<int, 3, 4> reader(device, pin, 0x3b, [](const char* block, int (&out)[3]) {
+        std::copy_n(block, 3, out);
+        return block[0] != 3;
+    });
+    decltype(reader)::sample_t samples[4];
+
+    REQUIRE(reader.start());
+    reader.set_batch_size(2);
+
+    /* Data register address is written before reading the block */
+    pin.trigger();
+    REQUIRE(device.m_register == 0x3b);
+    device.complete();
+
+    /* Data ready during a transfer is an overrun */
+    pin.trigger();
+    REQUIRE(reader.get_overruns() == 1);
+
+    device.complete();
+    REQUIRE(reader.get_size() == 1);
+    REQUIRE_FALSE(reader.wait_batch(emblib::rtos::ticks_t(0)));
+
+    pin.trigger();
+    device.complete();
+    device.complete();
+    REQUIRE(reader.wait_batch(emblib::rtos::ticks_t(1)));
+
+    /* Failed transfer is not buffered */
+    pin.trigger();
+    device.complete(false);
+    REQUIRE(reader.get_errors() == 1);
+    REQUIRE(reader.get_size() == 2);
+
+    /* Third block doesn't decode */
+    pin.trigger();
+    device.complete();
+    device.complete();
+    REQUIRE(reader.read(samples, 4) == 2);
+    REQUIRE(samples[0].data[0] == 1);
+    REQUIRE(samples[1].data[2] == 2);
+    REQUIRE(samples[0].timestamp <= samples[1].timestamp);
+    REQUIRE(reader.get_errors() == 2);
+
+    REQUIRE(reader.stop());
+    pin.trigger();
+    REQUIRE(reader.get_size() == 0);
+}
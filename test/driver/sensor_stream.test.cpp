@@ -0,0 +1,76 @@
+#include "emblib/driver/sensor_stream.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+namespace {
+
+/**
+ * Sensor which returns an incrementing value on all axes
+ */
+class fake_sensor : public emblib::driver::three_axis_sensor<int> {
+public:
+    bool probe() noexcept override
+    {
+        return true;
+    }
+
+    bool is_data_available() noexcept override
+    {
+        return m_value < 2;
+    }
+
+    bool read_axis(axis_e axis, int& out) noexcept override
+    {
+        UNUSED(axis);
+        out = m_value;
+        return true;
+    }
+
+    bool read_all_axes(int (&out_data)[3]) noexcept override
+    {
+        m_value++;
+        out_data[0] = out_data[1] = out_data[2] = m_value;
+        return true;
+    }
+
+    float get_noise_density() const noexcept override
+    {
+        return 0.0f;
+    }
+
+private:
+    int m_value = 0;
+};
+
+}
+
+TEST_CASE("Sensor stream test", "[driver][sensor_stream]")
+{
+    using emblib::rtos::monotonic_clock;
+
+    fake_sensor sensor;
+    emblib::driver::sensor_stream<int, 1> stream(sensor);
+    decltype(stream)::sample_t sample;
+
+    /* Sample is stamped with the data ready time, not the read time */
+    const monotonic_clock::time_point before = monotonic_clock::now();
+    stream.capture_data_ready_from_isr();
+    const monotonic_clock::time_point captured = monotonic_clock::now();
+    REQUIRE(stream.acquire(emblib::rtos::ticks_t(1)));
+    REQUIRE(stream.receive(sample, emblib::rtos::ticks_t(0)));
+    REQUIRE(sample.data[0] == 1);
+    REQUIRE(sample.timestamp >= before);
+    REQUIRE(sample.timestamp <= captured);
+
+    /* Polling without a data ready interrupt, second one finds no new data */
+    REQUIRE(stream.acquire());
+    REQUIRE_FALSE(stream.acquire());
+    REQUIRE(stream.get_dropped() == 0);
+
+    stream.capture_data_ready_from_isr();
+    REQUIRE_FALSE(stream.acquire(emblib::rtos::ticks_t(1)));
+    REQUIRE(stream.get_dropped() == 1);
+
+    REQUIRE(stream.receive(sample, emblib::rtos::ticks_t(0)));
+    REQUIRE(sample.data[2] == 2);
+    REQUIRE_FALSE(stream.receive(sample, emblib::rtos::ticks_t(0)));
+}
@@ -0,0 +1,115 @@
+#include "emblib/driver/three_axis_sensor.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+
+namespace {
+
+/**
+ * Sensor without a FIFO, which has `m_available` new samples
+ */
+class polled_sensor : public emblib::driver::three_axis_sensor<int> {
+public:
+    bool probe() noexcept override
+    {
+        return true;
+    }
+
+    bool is_data_available() noexcept override
+    {
+        return m_available > 0;
+    }
+
+    bool read_axis(axis_e axis, int& out) noexcept override
+    {
+        UNUSED(axis);
+        out = m_value;
+        return true;
+    }
+
+    bool read_all_axes(int (&out_data)[3]) noexcept override
+    {
+        m_available--;
+        m_value++;
+        out_data[0] = out_data[1] = out_data[2] = m_value;
+        return true;
+    }
+
+    float get_noise_density() const noexcept override
+    {
+        return 0.0f;
+    }
+
+    int m_available = 0;
+
+private:
+    int m_value = 0;
+};
+
+/**
+ * Sensor with a FIFO read in a single transaction
+ */
+class fifo_sensor : public polled_sensor {
+public:
+    size_t read_fifo(sample_s* out_samples, size_t count, timestamp_t newest) noexcept override
+    {
+        count = std::min(count, static_cast<size_t>(m_available));
+        for (size_t i = 0; i < count; i++) {
+            read_all_axes(out_samples[i].data);
+        }
+        set_fifo_timestamps(out_samples, count, newest, std::chrono::milliseconds(1));
+        return count;
+    }
+
+    bool set_fifo_watermark(size_t samples) noexcept override
+    {
+        if (samples == 0 || samples > 32) {
+            return false;
+        }
+        m_watermark = samples;
+        return true;
+    }
+
+    size_t get_fifo_watermark() const noexcept override
+    {
+        return m_watermark;
+    }
+
+private:
+    size_t m_watermark = 1;
+};
+
+}
+
+TEST_CASE("Three axis sensor FIFO test", "[driver][three_axis_sensor]")
+{
+    using sample_t = emblib::driver::three_axis_sensor<int>::sample_s;
+    sample_t samples[4];
+    const emblib::driver::three_axis_sensor<int>::timestamp_t now(std::chrono::milliseconds(10));
+
+    SECTION("Default reads only the newest sample") {
+        polled_sensor sensor;
+        sensor.m_available = 2;
+        REQUIRE(sensor.read_fifo(samples, 4, now) == 1);
+        REQUIRE(samples[0].data[1] == 1);
+        REQUIRE(samples[0].timestamp == now);
+        REQUIRE(sensor.read_fifo(samples, 4, now) == 1);
+        REQUIRE(samples[0].data[1] == 2);
+        REQUIRE(sensor.read_fifo(samples, 4, now) == 0);
+
+        REQUIRE_FALSE(sensor.set_fifo_watermark(16));
+        REQUIRE(sensor.get_fifo_watermark() == 1);
+    }
+
+    SECTION("Batch read is stamped back from the newest sample") {
+        fifo_sensor sensor;
+        sensor.m_available = 3;
+        REQUIRE(sensor.read_fifo(samples, 4, now) == 3);
+        REQUIRE(samples[2].data[0] == 3);
+        REQUIRE(samples[0].timestamp.time_since_epoch() == std::chrono::milliseconds(8));
+        REQUIRE(samples[2].timestamp.time_since_epoch() == std::chrono::milliseconds(10));
+
+        REQUIRE(sensor.set_fifo_watermark(16));
+        REQUIRE_FALSE(sensor.set_fifo_watermark(64));
+        REQUIRE(sensor.get_fifo_watermark() == 16);
+    }
+}
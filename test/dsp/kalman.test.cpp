@@ -22,4 +22,4 @@ TEST_CASE("Kalman linear update", "[dsp][kalman]")
     vectorf<3> expected = {0.348207, -0.381673, 0.407171};
 
     REQUIRE(state.get_base().isApprox(expected.get_base()));
-}
\ No newline at end of file
+}
@@ -0,0 +1,63 @@
+#include "emblib/dsp/sample_aligner.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cmath>
+
+namespace {
+
+using sample_t = emblib::dsp::sample_aligner<float, 2, 4>::sample_t;
+
+static sample_t make_sample(int time_us, float value) noexcept
+{
+    sample_t sample;
+    sample.timestamp = emblib::rtos::timestamp_t(std::chrono::microseconds(time_us));
+    sample.data[0] = sample.data[1] = sample.data[2] = value;
+    return sample;
+}
+
+}
+
+TEST_CASE("Sample aligner test", "[dsp][sample_aligner]")
+{
+    emblib::dsp::sample_aligner<float, 2, 4> aligner;
+    decltype(aligner)::aligned_s aligned;
+
+    /* Reference waits until the other stream passes its timestamp */
+    REQUIRE(aligner.push(1, make_sample(0, 0.0f)));
+    REQUIRE(aligner.push(0, make_sample(250, 1.0f)));
+    REQUIRE_FALSE(aligner.pop(aligned));
+    REQUIRE(aligner.get_pending() == 1);
+
+    REQUIRE(aligner.push(1, make_sample(1000, 4.0f)));
+    REQUIRE(aligner.pop(aligned));
+    REQUIRE(aligned.samples[0].data[0] == 1.0f);
+    REQUIRE(aligned.samples[1].timestamp == aligned.samples[0].timestamp);
+    REQUIRE(std::abs(aligned.samples[1].data[2] - 1.0f) < 1e-5f);
+    REQUIRE_FALSE(aligner.pop(aligned));
+
+    /* Faster stream pushed more than once is still interpolated from its history */
+    REQUIRE(aligner.push(1, make_sample(2000, 8.0f)));
+    REQUIRE(aligner.push(0, make_sample(500, 2.0f)));
+    REQUIRE(aligner.pop(aligned));
+    REQUIRE(std::abs(aligned.samples[1].data[0] - 2.0f) < 1e-5f);
+
+    REQUIRE_FALSE(aligner.push(2, make_sample(0, 0.0f)));
+}
+
+TEST_CASE("Sample aligner history test", "[dsp][sample_aligner]")
+{
+    emblib::dsp::sample_aligner<float, 2, 4, 3> aligner;
+    decltype(aligner)::aligned_s aligned;
+
+    REQUIRE(aligner.push(0, make_sample(1500, 1.0f)));
+    REQUIRE(aligner.push(0, make_sample(2500, 2.0f)));
+    for (int i = 0; i <= 4; i++) {
+        REQUIRE(aligner.push(1, make_sample(i * 1000, i * 4.0f)));
+    }
+
+    /* Only the last 3 samples are kept, so the first reference takes the oldest one */
+    REQUIRE(aligner.pop(aligned));
+    REQUIRE(aligned.samples[1].data[0] == 8.0f);
+    REQUIRE(aligner.pop(aligned));
+    REQUIRE(std::abs(aligned.samples[1].data[1] - 10.0f) < 1e-5f);
+    REQUIRE(aligned.samples[1].timestamp == aligned.samples[0].timestamp);
+}
@@ -1,5 +1,6 @@
 #include "emblib/math/matrix.hpp"
 #include "catch2/catch_test_macros.hpp"
+#include <cmath>
 
 TEST_CASE("Matrix division", "[math][matrix]")
 {
@@ -16,6 +17,24 @@ TEST_CASE("Matrix division", "[math][matrix]")
     REQUIRE(b.matdivr(a).get_base().isApprox(right_div_exp.get_base()));
 }
 
+TEST_CASE("Matrix multiplication accumulation", "[math][matrix]")
+{
+    using emblib::math::matrixf;
+    using emblib::math::accumulate_e;
+    matrixf<2, 4> a {{1e8f, 1, 1, -1e8f}, {1, 1e8f, -1e8f, 1}};
+    matrixf<4, 2> b {{1, 1}, {1, 1}, {1, 1}, {1, 1}};
+
+    /* Small terms are lost next to the large ones when summed in float */
+    const matrixf<2, 2> native = a.matmul(b);
+    const matrixf<2, 2> precise = a.matmul<accumulate_e::DOUBLE>(b);
+    const matrixf<2, 2> compensated = a.matmul<accumulate_e::KAHAN>(b);
+
+    REQUIRE(native(0, 0) != 2);
+    REQUIRE(native(1, 1) != 2);
+    REQUIRE((precise == matrixf<2, 2> {{2, 2}, {2, 2}}).all());
+    REQUIRE((compensated == matrixf<2, 2> {{2, 2}, {2, 2}}).all());
+}
+
 TEST_CASE("Matrix logical", "[math][matrix]")
 {
     using emblib::math::matrixf;
@@ -71,4 +90,49 @@ TEST_CASE("Matrix submatrix set", "[math][matrix]")
     
     matrixf<3, 4> expected {{1, 2, 3, 4}, {5, 3, 0, 8}, {9, 0, 3, 12}};
     REQUIRE((a == expected).all());
-}
\ No newline at end of file
+}
+
+TEST_CASE("Matrix inverse and determinant", "[math][matrix]")
+{
+    using emblib::math::matrixf;
+    matrixf<3> a {{2, 0, 1}, {1, 3, 2}, {1, 1, 2}};
+
+    REQUIRE(std::abs(a.determinant() - 6) < 1e-4f);
+    REQUIRE(a.matmul(a.inverse()).get_base().isApprox(matrixf<3>::diagonal().get_base()));
+
+    matrixf<4> b {{4, 0, 0, 0}, {0, 2, 0, 0}, {0, 0, 1, 0}, {1, 0, 0, 1}};
+    REQUIRE(std::abs(b.determinant() - 8) < 1e-4f);
+    REQUIRE(b.inverse().matmul(b).get_base().isApprox(matrixf<4>::diagonal().get_base()));
+}
+
+TEST_CASE("Matrix division large", "[math][matrix]")
+{
+    using emblib::math::matrixf;
+    matrixf<5> a = matrixf<5>::diagonal(2);
+    a(0, 4) = 1;
+    a(3, 1) = -1;
+    matrixf<5, 2> b {{1, 2}, {3, 4}, {5, 6}, {7, 8}, {9, 10}};
+
+    REQUIRE(std::abs(a.determinant() - 32) < 1e-4f);
+    REQUIRE(a.matmul(b.matdivl(a)).get_base().isApprox(b.get_base()));
+    REQUIRE(a.matmul(b.matdivl<emblib::math::solver_e::DIRECT>(a)).get_base().isApprox(b.get_base()));
+}
+
+TEST_CASE("Matrix division singular", "[math][matrix]")
+{
+    using emblib::math::matrixf;
+    using emblib::math::solver_e;
+    matrixf<2, 2> a {{1, 2}, {2, 4}};
+    matrixf<2, 1> b {{1}, {2}};
+
+    /* Least-squares solution for a singular divisor, direct inverse is not finite */
+    const matrixf<2, 1> res = b.matdivl(a);
+    REQUIRE(res.get_base().allFinite());
+    REQUIRE(a.matmul(res).get_base().isApprox(b.get_base()));
+    REQUIRE_FALSE(matrixf<2, 1>(b.matdivl<solver_e::DIRECT>(a)).get_base().allFinite());
+
+    /* Methods agree for a regular divisor */
+    matrixf<3> c {{2, 0, 1}, {1, 3, 2}, {1, 1, 2}};
+    matrixf<3, 2> d {{1, 2}, {3, 4}, {5, 6}};
+    REQUIRE(d.matdivl(c).get_base().isApprox(d.matdivl<solver_e::DIRECT>(c).get_base()));
+}
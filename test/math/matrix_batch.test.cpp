@@ -0,0 +1,49 @@
+#include "emblib/math/matrix_batch.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("Matrix batch matmul", "[math][matrix]")
+{
+    using emblib::math::matrixf;
+    using emblib::math::matrixf_batch;
+
+    matrixf<2, 3> a0 {{1, 2, 3}, {4, 5, 6}};
+    matrixf<2, 3> a1 {{-1, 0, 2}, {3, 1, 1}};
+    matrixf<3, 2> b0 {{1, 0}, {0, 1}, {1, 1}};
+    matrixf<3, 2> b1 {{2, 1}, {1, 2}, {0, 3}};
+
+    matrixf_batch<2, 3, 2> a;
+    matrixf_batch<3, 2, 2> b;
+    a.set_matrix(0, a0);
+    a.set_matrix(1, a1);
+    b.set_matrix(0, b0);
+    b.set_matrix(1, b1);
+
+    const auto res = a.matmul(b);
+    REQUIRE((res.get_matrix(0) == a0.matmul(b0)).all());
+    REQUIRE((res.get_matrix(1) == a1.matmul(b1)).all());
+    REQUIRE((a.transpose().get_matrix(1) == a1.transpose()).all());
+    REQUIRE(((a + a).get_matrix(0) == a0 * 2.f).all());
+}
+
+TEST_CASE("Matrix batch division", "[math][matrix]")
+{
+    using emblib::math::matrixf;
+    using emblib::math::matrixf_batch;
+
+    /* Second divisor requires pivoting */
+    matrixf<3> a0 {{2, 0, 1}, {1, 3, 2}, {1, 1, 2}};
+    matrixf<3> a1 {{0, 1, 0}, {1, 0, 0}, {0, 0, 4}};
+    matrixf<3, 1> b0 {{1}, {2}, {3}};
+    matrixf<3, 1> b1 {{4}, {5}, {8}};
+
+    matrixf_batch<3, 3, 2> a;
+    matrixf_batch<3, 1, 2> b;
+    a.set_matrix(0, a0);
+    a.set_matrix(1, a1);
+    b.set_matrix(0, b0);
+    b.set_matrix(1, b1);
+
+    const auto res = b.matdivl(a);
+    REQUIRE(res.get_matrix(0).get_base().isApprox(b0.matdivl(a0).get_base()));
+    REQUIRE((res.get_matrix(1) == matrixf<3, 1> {{5}, {4}, {2}}).all());
+}
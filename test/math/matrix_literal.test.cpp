@@ -0,0 +1,40 @@
+#include "emblib/math/matrix_literal.hpp"
+#include "emblib/math/quaternion.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("Matrix literal constexpr", "[math][matrix]")
+{
+    using emblib::math::matrixf_literal;
+    using emblib::math::matrixf;
+
+    static constexpr matrixf_literal<2, 3> a {{{1, 2, 3}, {4, 5, 6}}};
+    static_assert(a(0, 2) == 3);
+    static_assert(a(1, 0) == 4);
+    static_assert(matrixf_literal<3>::diagonal(2)(1, 1) == 2);
+
+    matrixf<3, 2> b {{1, 0}, {0, 1}, {1, 1}};
+    matrixf<2, 2> expected {{4, 5}, {10, 11}};
+    REQUIRE((a.get_matrix().matmul(b) == expected).all());
+}
+
+TEST_CASE("Vector literal constexpr", "[math][vector]")
+{
+    using emblib::math::vectorf_literal;
+    using emblib::math::vector3f;
+
+    static constexpr vectorf_literal<3> a {{1, 2, 3}};
+    static_assert(a(2) == 3);
+
+    vector3f b {7, 6, 5};
+    REQUIRE(a.get_vector().dot(b) == (7 + 12 + 15));
+    REQUIRE((vector3f(a.get_vector()) == vector3f {1, 2, 3}).all());
+}
+
+TEST_CASE("Quaternion constexpr", "[math][quaternion]")
+{
+    using emblib::math::quaternionf;
+
+    static constexpr quaternionf q = quaternionf {0, 1, 0, 0} * quaternionf {0, 0, 1, 0};
+    static_assert(q.get_real() == 0);
+    static_assert(q.conjugate().get_real() == 0);
+}
@@ -17,4 +17,15 @@ TEST_CASE("Vector cross product", "[math][vector]")
     vectorf<3> b {7, 6, 5};
 
     REQUIRE((a.cross(b) == vectorf<3> {-8, 16, -8}).all());
-}
\ No newline at end of file
+}
+
+TEST_CASE("Vector dot product accumulation", "[math][vector]")
+{
+    using emblib::math::vectorf;
+    using emblib::math::accumulate_e;
+    vectorf<4> a {1e8f, 1, -1e8f, 1};
+    vectorf<4> b {1, 1, 1, 1};
+
+    REQUIRE(a.dot<accumulate_e::DOUBLE>(b) == 2);
+    REQUIRE(a.dot<accumulate_e::KAHAN>(b) == 2);
+}
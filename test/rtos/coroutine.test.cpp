@@ -0,0 +1,154 @@
+#include "emblib/rtos/coroutine.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+
+#if __cpp_impl_coroutine >= 201902L
+
+using namespace emblib::rtos;
+
+namespace {
+
+coroutine sum_items(queue<int, 4>& items, semaphore& done, int& sum)
+{
+    int item;
+    while (co_await async_receive(items, item, ticks_t(0))) {
+        sum += item;
+    }
+    done.give();
+}
+
+coroutine poll_items(queue<int, 4>& items, int& timeouts)
+{
+    int item;
+    while (timeouts < 3) {
+        if (!co_await async_receive(items, item, ticks_t(0))) {
+            timeouts++;
+        }
+    }
+}
+
+/**
+ * Bus which completes each async operation right away, as if from the interrupt
+ */
+class fake_i2c_bus : public emblib::driver::i2c_bus {
+public:
+    ssize_t write(emblib::driver::i2c_address_t address, const char* data, size_t size, emblib::milliseconds timeout) noexcept override
+    {
+        UNUSED(address);
+        UNUSED(data);
+        UNUSED(timeout);
+        return size;
+    }
+
+    ssize_t read(emblib::driver::i2c_address_t address, char* buffer, size_t size, emblib::milliseconds timeout) noexcept override
+    {
+        UNUSED(address);
+        UNUSED(buffer);
+        UNUSED(timeout);
+        return size;
+    }
+
+    bool write_async(emblib::driver::i2c_address_t address, const char* data, size_t size, const callback_t cb) noexcept override
+    {
+        m_address = address;
+        m_register = *data;
+        cb(size);
+        return true;
+    }
+
+    bool read_async(emblib::driver::i2c_address_t address, char* buffer, size_t size, const callback_t cb) noexcept override
+    {
+        m_address = address;
+        std::fill_n(buffer, size, m_register);
+        cb(size);
+        return true;
+    }
+
+    bool reset() noexcept override
+    {
+        return true;
+    }
+
+    emblib::driver::i2c_address_t m_address = 0;
+    char m_register = 0;
+};
+
+coroutine read_register(emblib::driver::i2c_bus& bus, char* buffer, ssize_t& result)
+{
+    const char data_register = 0x3b;
+    if (co_await async_write(bus, 0x68, &data_register, 1) == 1) {
+        result = co_await async_read(bus, 0x68, buffer, 2);
+    }
+}
+
+}
+
+TEST_CASE("RTOS coroutine test", "[rtos][coroutine]")
+{
+    static coroutine_scheduler scheduler;
+    static queue<int, 4> items;
+    static semaphore done;
+    int sum = 0;
+
+    items.send(1, ticks_t(0));
+    items.send(2, ticks_t(0));
+
+    REQUIRE(scheduler.spawn(sum_items(items, done, sum)));
+    REQUIRE(coroutine::get_frames_used() == 1);
+
+    /* Drains the queue, then the wait with zero timeout expires when polled */
+    scheduler.run_once(ticks_t(0));
+    REQUIRE(sum == 3);
+
+    REQUIRE(done.take(ticks_t(0)));
+    REQUIRE(coroutine::get_frames_used() == 0);
+}
+
+TEST_CASE("RTOS coroutine wait again test", "[rtos][coroutine]")
+{
+    static coroutine_scheduler scheduler;
+    static queue<int, 4> items;
+    int timeouts = 0;
+
+    REQUIRE(scheduler.spawn(poll_items(items, timeouts)));
+
+    /* Coroutine which waits again after a timeout is polled once per run */
+    scheduler.run_once(ticks_t(0));
+    REQUIRE(timeouts == 1);
+    scheduler.run_once(ticks_t(0));
+    REQUIRE(timeouts == 2);
+    scheduler.run_once(ticks_t(0));
+    REQUIRE(timeouts == 3);
+    REQUIRE(coroutine::get_frames_used() == 0);
+}
+
+TEST_CASE("RTOS coroutine I2C test", "[rtos][coroutine]")
+{
+    static coroutine_scheduler scheduler;
+    fake_i2c_bus bus;
+    char buffer[2] = {0};
+    ssize_t result = -1;
+
+    REQUIRE(scheduler.spawn(read_register(bus, buffer, result)));
+    scheduler.run_once(ticks_t(0));
+
+    REQUIRE(result == 2);
+    REQUIRE(bus.m_address == 0x68);
+    REQUIRE(buffer[1] == 0x3b);
+    REQUIRE(coroutine::get_frames_used() == 0);
+}
+
+#endif
+
+TEST_CASE("RTOS coroutine tick wraparound test", "[rtos][coroutine]")
+{
+    /* Timeouts are measured from the start of the wait, so they stay correct
+     * when the native tick count wraps around */
+    const ticks_t start = task::get_tick_count();
+    REQUIRE(task::get_ticks_between(start, start + ticks_t(5)) == ticks_t(5));
+
+#if EMBLIB_RTOS_USE_FREERTOS
+    const ticks_t before_wrap(portMAX_DELAY - 2);
+    REQUIRE(task::get_ticks_between(before_wrap, ticks_t(3)) == ticks_t(6));
+#endif
+}
@@ -0,0 +1,56 @@
+#include "emblib/rtos/cpu_load.hpp"
+#include "emblib/rtos/task.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+#if EMBLIB_RTOS_SUPPORT_RUNTIME_STATS
+
+namespace {
+
+static size_t stack_high_water_mark = 0;
+static uint64_t busy_runtime = 0;
+static float load = 0.0f;
+
+/**
+ * Keeps the CPU busy for half of each period
+ */
+class busy_task : public emblib::rtos::task {
+public:
+    busy_task() : task("busy", 2, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        emblib::rtos::cpu_load cpu_load;
+        cpu_load.sample();
+
+        for (int i = 0; i < 20; i++) {
+            const TickType_t start = xTaskGetTickCount();
+            while (xTaskGetTickCount() - start < 5) {}
+            sleep_periodic(std::chrono::milliseconds(10));
+        }
+
+        load = cpu_load.sample();
+        stack_high_water_mark = get_stack_high_water_mark();
+        busy_runtime = get_runtime_counter();
+        emblib::rtos::task::stop_tasks();
+    }
+
+    emblib::rtos::task_stack_t<32 * 1024> m_stack;
+};
+
+}
+
+TEST_CASE("RTOS task runtime stats test", "[.][rtos][cpu_load][scheduler]")
+{
+    static busy_task busy;
+
+    emblib::rtos::task::start_tasks();
+
+    REQUIRE(busy.get_deadline_misses() == 0);
+    REQUIRE(stack_high_water_mark > 0);
+    REQUIRE(stack_high_water_mark < 32 * 1024);
+    REQUIRE(busy_runtime > 0);
+    REQUIRE((load > 0.3f && load < 0.7f));
+}
+
+#endif
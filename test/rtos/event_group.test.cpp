@@ -0,0 +1,26 @@
+#include "emblib/rtos/event_group.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("RTOS event group test", "[rtos][event_group]")
+{
+    constexpr emblib::rtos::event_group::bits_t RX_DONE = 1 << 0;
+    constexpr emblib::rtos::event_group::bits_t TX_DONE = 1 << 1;
+    const auto no_wait = std::chrono::milliseconds(0);
+
+    emblib::rtos::event_group events;
+
+    REQUIRE(events.get() == 0);
+    REQUIRE(events.set(RX_DONE) == RX_DONE);
+
+    /* Waiting for all times out, but the bits stay set */
+    REQUIRE(events.wait(RX_DONE | TX_DONE, true, true, no_wait) == RX_DONE);
+    REQUIRE(events.get() == RX_DONE);
+
+    /* Waiting for any returns immediately and clears the waited bits */
+    REQUIRE(events.wait(RX_DONE | TX_DONE, false, true, no_wait) == RX_DONE);
+    REQUIRE(events.get() == 0);
+
+    events.set(RX_DONE | TX_DONE);
+    REQUIRE(events.clear(TX_DONE) == (RX_DONE | TX_DONE));
+    REQUIRE(events.get() == RX_DONE);
+}
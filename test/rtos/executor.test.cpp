@@ -0,0 +1,48 @@
+#include "emblib/rtos/executor.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <atomic>
+#include <string>
+
+using executor_t = emblib::rtos::executor<2, 4, 32 * 1024>;
+
+TEST_CASE("RTOS executor test", "[rtos][executor]")
+{
+    static executor_t executor("executor", 1);
+    static std::atomic<int> runs {0};
+
+    /* Without the scheduler running, jobs only pile up in the queue */
+    for (int i = 0; i < 4; i++)
+        REQUIRE(executor.post([] {runs++;}));
+    REQUIRE_FALSE(executor.post([] {runs++;}, executor_t::priority_e::HIGH));
+
+    REQUIRE(executor.get_pending() == 4);
+    REQUIRE(runs == 0);
+
+    REQUIRE(std::string(executor.get_worker_name(0)) == "executor0");
+    REQUIRE(std::string(executor.get_worker_name(1)) == "executor1");
+}
+
+namespace {
+
+static char order[4] = {0};
+static size_t order_idx = 0;
+
+}
+
+TEST_CASE("RTOS executor priority test", "[.][rtos][executor][scheduler]")
+{
+    /* Single worker so jobs run one after another */
+    static emblib::rtos::executor<1, 4, 32 * 1024> executor("executor", 2);
+
+    executor.post([] {order[order_idx++] = 'n';});
+    executor.post([] {order[order_idx++] = 'h';}, decltype(executor)::priority_e::HIGH);
+    executor.post([] {
+        order[order_idx++] = 'e';
+        emblib::rtos::task::stop_tasks();
+    });
+
+    emblib::rtos::task::start_tasks();
+
+    REQUIRE(std::string(order) == "hne");
+    REQUIRE(executor.get_max_pending() == 3);
+}
@@ -0,0 +1,88 @@
+#include "emblib/rtos/isr_context.hpp"
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/task.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <chrono>
+
+TEST_CASE("RTOS ISR context test", "[rtos][isr_context]")
+{
+    emblib::rtos::queue<int, 2> queue;
+    int buffer = 0;
+
+    {
+        /* Nobody is waiting on the queue, so no switch is requested */
+        emblib::rtos::isr_context context;
+        REQUIRE(queue.send_from_isr(1, &context));
+        REQUIRE_FALSE(context.is_task_woken());
+    }
+
+    REQUIRE(queue.receive_from_isr(buffer));
+    REQUIRE(buffer == 1);
+}
+
+#if EMBLIB_RTOS_SUPPORT_NOTIFICATIONS
+
+namespace {
+
+using clock_type = std::chrono::steady_clock;
+
+static clock_type::time_point notified_at;
+static clock_type::duration wake_latency {};
+static bool was_task_woken = false;
+
+/**
+ * Waits for the notification and measures the time it took to get running
+ */
+class waiter_task : public emblib::rtos::task {
+public:
+    waiter_task() : task("waiter", 3, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        wait_notification();
+        wake_latency = clock_type::now() - notified_at;
+        emblib::rtos::task::stop_tasks();
+    }
+
+    emblib::rtos::task_stack_t<32 * 1024> m_stack;
+};
+
+/**
+ * Stands in for an interrupt routine which notifies the waiter
+ */
+class notifier_task : public emblib::rtos::task {
+public:
+    notifier_task(waiter_task& waiter) : task("notifier", 2, m_stack), m_waiter(waiter) {}
+
+private:
+    void run() noexcept override
+    {
+        /* Let the waiter block first */
+        sleep(std::chrono::milliseconds(1));
+
+        emblib::rtos::isr_context context;
+        notified_at = clock_type::now();
+        m_waiter.notify_from_isr(&context);
+        was_task_woken = context.is_task_woken();
+    }
+
+    waiter_task& m_waiter;
+    emblib::rtos::task_stack_t<32 * 1024> m_stack;
+};
+
+}
+
+TEST_CASE("RTOS ISR context wake up latency test", "[.][rtos][isr_context][scheduler]")
+{
+    static waiter_task waiter;
+    static notifier_task notifier(waiter);
+
+    emblib::rtos::task::start_tasks();
+
+    /* Without the yield on exit the waiter would run only on the next tick */
+    REQUIRE(was_task_woken);
+    REQUIRE(wake_latency < std::chrono::milliseconds(1));
+}
+
+#endif
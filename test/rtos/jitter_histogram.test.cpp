@@ -0,0 +1,35 @@
+#include "emblib/rtos/jitter_histogram.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("RTOS jitter histogram test", "[rtos][jitter_histogram]")
+{
+    using std::chrono::microseconds;
+
+    emblib::rtos::jitter_histogram<8> histogram(microseconds(1000), microseconds(10));
+
+    for (int i = 0; i < 98; i++)
+        histogram.record(microseconds(i % 2 ? 5 : -5));
+    histogram.record(microseconds(25));
+    histogram.record(microseconds(500));
+
+    REQUIRE(histogram.get_count() == 100);
+    REQUIRE(histogram.get_min() == microseconds(-5));
+    REQUIRE(histogram.get_max() == microseconds(500));
+
+    /* Bins start at -40 us, the last one collects everything above 30 us */
+    REQUIRE(histogram.get_bin(3) == 49);
+    REQUIRE(histogram.get_bin(4) == 49);
+    REQUIRE(histogram.get_bin(6) == 1);
+    REQUIRE(histogram.get_bin(7) == 1);
+
+    REQUIRE(histogram.get_percentile(50) == microseconds(10));
+    REQUIRE(histogram.get_percentile(99) == microseconds(30));
+    REQUIRE(histogram.get_percentile(100) == microseconds(500));
+
+    histogram.record_wakeup(false);
+    REQUIRE(histogram.get_overruns() == 1);
+    REQUIRE(histogram.get_count() == 100);
+
+    histogram.reset();
+    REQUIRE(histogram.get_count() == 0);
+}
@@ -0,0 +1,20 @@
+#include "emblib/rtos/message_buffer.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cstring>
+
+TEST_CASE("RTOS message buffer test", "[rtos][message_buffer]")
+{
+    emblib::rtos::message_buffer<32> messages;
+    const char first[] = "abc";
+    const char second[] = "defgh";
+    char buffer[8] = {0};
+
+    REQUIRE(messages.send(first, sizeof(first), std::chrono::milliseconds(0)));
+    REQUIRE(messages.send(second, sizeof(second), std::chrono::milliseconds(0)));
+
+    REQUIRE(messages.get_next_size() == sizeof(first));
+    REQUIRE(messages.receive(buffer, sizeof(buffer), std::chrono::milliseconds(0)) == sizeof(first));
+    REQUIRE(std::strcmp(buffer, first) == 0);
+    REQUIRE(messages.receive(buffer, sizeof(buffer), std::chrono::milliseconds(0)) == sizeof(second));
+    REQUIRE(std::strcmp(buffer, second) == 0);
+}
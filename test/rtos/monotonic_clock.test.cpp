@@ -0,0 +1,28 @@
+#include "emblib/rtos/monotonic_clock.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("RTOS monotonic clock test", "[rtos][monotonic_clock]")
+{
+    using emblib::rtos::monotonic_clock;
+    using std::chrono::microseconds;
+
+    const monotonic_clock::time_point start = monotonic_clock::now();
+    REQUIRE(monotonic_clock::now() >= start);
+
+    /* Shorter than a tick, so it is spun without the scheduler running */
+    monotonic_clock::delay(microseconds(200));
+    REQUIRE(monotonic_clock::now() - start >= microseconds(200));
+}
+
+TEST_CASE("RTOS ticks conversion test", "[rtos][monotonic_clock]")
+{
+    using emblib::rtos::ticks_t;
+    using std::chrono::microseconds;
+
+    const microseconds tick = std::chrono::duration_cast<microseconds>(ticks_t(1));
+
+    /* Rounds up so a timeout is never shorter than requested */
+    REQUIRE(emblib::rtos::to_ticks(tick * 2) == ticks_t(2));
+    REQUIRE(emblib::rtos::to_ticks(tick * 2 + microseconds(1)) == ticks_t(3));
+    REQUIRE(emblib::rtos::to_ticks(microseconds(0)) == ticks_t(0));
+}
@@ -7,4 +7,43 @@ TEST_CASE("RTOS mutex test", "[rtos][mutex]")
 
     REQUIRE(mutex.lock());
     REQUIRE(mutex.unlock());
-}
\ No newline at end of file
+}
+
+TEST_CASE("RTOS scoped lock test", "[rtos][mutex]")
+{
+    emblib::rtos::mutex mutex;
+
+    {
+        emblib::rtos::scoped_lock lock(mutex);
+        REQUIRE(lock.is_locked());
+
+        /* Already held, so this one times out and must not unlock */
+        emblib::rtos::scoped_lock other(mutex, emblib::rtos::ticks_t(0));
+        REQUIRE_FALSE(other.is_locked());
+    }
+    REQUIRE(mutex.try_lock());
+    REQUIRE(mutex.unlock());
+}
+
+#if EMBLIB_RTOS_SUPPORT_MUTEX_STATS
+TEST_CASE("RTOS mutex stats test", "[rtos][mutex]")
+{
+    emblib::rtos::mutex mutex;
+
+    /* Failed unlock doesn't count as a hold */
+    REQUIRE_FALSE(mutex.unlock());
+    REQUIRE(mutex.get_stats().max_hold == 0);
+
+    REQUIRE(mutex.lock());
+    REQUIRE_FALSE(mutex.try_lock());
+    REQUIRE(mutex.unlock());
+
+    const emblib::rtos::mutex::stats_s stats = mutex.get_stats();
+    REQUIRE(stats.lock_count == 1);
+    REQUIRE(stats.timeout_count == 1);
+    REQUIRE(stats.max_wait <= stats.total_wait);
+
+    mutex.reset_stats();
+    REQUIRE(mutex.get_stats().lock_count == 0);
+}
+#endif
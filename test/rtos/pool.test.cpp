@@ -0,0 +1,60 @@
+#include "emblib/rtos/arena.hpp"
+#include "emblib/rtos/pool.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+namespace {
+
+struct sample_s {
+    sample_s(int value) : value(value) {}
+    int value;
+    double data[3];
+};
+
+}
+
+TEST_CASE("RTOS pool test", "[rtos][pool]")
+{
+    emblib::rtos::pool<sample_s, 3> pool;
+
+    sample_s* a = pool.create(1);
+    sample_s* b = pool.create(2);
+    sample_s* c = pool.create(3);
+    REQUIRE((a && b && c));
+    REQUIRE((a != b && b != c && a != c));
+    REQUIRE(pool.create(4) == nullptr);
+    REQUIRE(pool.get_used() == 3);
+
+    /* Null from an exhausted pool is ignored */
+    pool.destroy(pool.create(4));
+    pool.free(nullptr);
+    REQUIRE(pool.get_used() == 3);
+    REQUIRE(pool.create(4) == nullptr);
+
+    pool.destroy(b);
+    sample_s* d = pool.create(5);
+    REQUIRE(d == b);
+    REQUIRE(d->value == 5);
+    REQUIRE(a->value == 1);
+
+    pool.destroy(a);
+    pool.destroy(c);
+    pool.destroy(d);
+    REQUIRE(pool.get_used() == 0);
+    REQUIRE(pool.get_max_used() == 3);
+}
+
+TEST_CASE("RTOS arena test", "[rtos][arena]")
+{
+    emblib::rtos::arena<64> arena;
+
+    char* byte = arena.create<char>('a');
+    double* number = arena.create<double>(1.5);
+    REQUIRE((byte && number));
+    REQUIRE(reinterpret_cast<uintptr_t>(number) % alignof(double) == 0);
+    REQUIRE(*number == 1.5);
+    REQUIRE(arena.get_used() == 8 + sizeof(double));
+
+    REQUIRE(arena.allocate(64) == nullptr);
+    arena.reset();
+    REQUIRE(arena.allocate(64) != nullptr);
+}
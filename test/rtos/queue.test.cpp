@@ -11,4 +11,18 @@ TEST_CASE("RTOS queue test", "[rtos][queue]")
     queue.receive(buffer, std::chrono::milliseconds(10));
 
     REQUIRE(to_send == buffer);
-}
\ No newline at end of file
+}
+
+TEST_CASE("RTOS queue batch test", "[rtos][queue]")
+{
+    emblib::rtos::queue<int, 4> queue;
+    int to_send[] = {1, 2, 3, 4, 5};
+    int buffer[5] = {0};
+
+    REQUIRE(queue.send_n(to_send, 5, std::chrono::milliseconds(0)) == 4);
+    REQUIRE(queue.receive_n(buffer, 3, std::chrono::milliseconds(0)) == 3);
+    REQUIRE(queue.receive_n(buffer + 3, 2, std::chrono::milliseconds(0)) == 1);
+
+    REQUIRE((buffer[0] == 1 && buffer[1] == 2 && buffer[2] == 3 && buffer[3] == 4));
+    REQUIRE(queue.receive_n(buffer, 2, std::chrono::milliseconds(0)) == 0);
+}
@@ -0,0 +1,33 @@
+#include "emblib/rtos/queue_set.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("RTOS queue set test", "[rtos][queue_set]")
+{
+    const auto no_wait = std::chrono::milliseconds(0);
+
+    emblib::rtos::queue<int, 2> commands;
+    emblib::rtos::semaphore data_ready;
+    emblib::rtos::queue_set<3> inputs;
+
+    REQUIRE(inputs.add(commands));
+    REQUIRE(inputs.add(data_ready));
+    REQUIRE(inputs.select(no_wait) == nullptr);
+
+    commands.send(7, no_wait);
+    data_ready.give();
+
+    /* Members are selected in the order in which they received data */
+    auto member = inputs.select(no_wait);
+    REQUIRE(inputs.is_selected(member, commands));
+    REQUIRE_FALSE(inputs.is_selected(member, data_ready));
+    int command = 0;
+    REQUIRE(commands.receive(command, no_wait));
+    REQUIRE(command == 7);
+
+    member = inputs.select(no_wait);
+    REQUIRE(inputs.is_selected(member, data_ready));
+    REQUIRE(data_ready.take(no_wait));
+
+    REQUIRE(inputs.select(no_wait) == nullptr);
+    REQUIRE(inputs.remove(commands));
+}
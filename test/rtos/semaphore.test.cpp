@@ -0,0 +1,17 @@
+#include "emblib/rtos/semaphore.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("RTOS semaphore test", "[rtos][semaphore]")
+{
+    const auto no_wait = std::chrono::milliseconds(0);
+    emblib::rtos::semaphore semaphore(2);
+
+    REQUIRE_FALSE(semaphore.take(no_wait));
+    REQUIRE(semaphore.give());
+    REQUIRE(semaphore.give_from_isr());
+    REQUIRE_FALSE(semaphore.give());
+
+    REQUIRE(semaphore.take(no_wait));
+    REQUIRE(semaphore.take(no_wait));
+    REQUIRE_FALSE(semaphore.take(no_wait));
+}
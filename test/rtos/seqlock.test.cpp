@@ -0,0 +1,72 @@
+#include "emblib/rtos/seqlock.hpp"
+#include "emblib/math/vector.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <thread>
+
+namespace {
+
+struct state_s {
+    uint32_t values[8];
+};
+
+static bool is_consistent(const state_s& state) noexcept
+{
+    for (uint32_t value : state.values) {
+        if (value != state.values[0])
+            return false;
+    }
+    return true;
+}
+
+}
+
+TEST_CASE("RTOS seqlock test", "[rtos][seqlock]")
+{
+    emblib::rtos::seqlock<int> lock(1);
+    int value = 0;
+
+    REQUIRE(lock.read() == 1);
+    REQUIRE(lock.get_write_count() == 0);
+
+    lock.write(2);
+    REQUIRE(lock.try_read(value));
+    REQUIRE(value == 2);
+    REQUIRE(lock.get_write_count() == 1);
+}
+
+TEST_CASE("RTOS seqlock concurrent test", "[rtos][seqlock]")
+{
+    static emblib::rtos::seqlock<state_s> lock;
+    constexpr uint32_t WRITE_COUNT = 100000;
+
+    std::thread writer([] {
+        for (uint32_t i = 1; i <= WRITE_COUNT; i++) {
+            state_s state;
+            std::fill(std::begin(state.values), std::end(state.values), i);
+            lock.write(state);
+        }
+    });
+
+    bool is_torn = false;
+    uint32_t last = 0;
+    while (last < WRITE_COUNT && !is_torn) {
+        const state_s state = lock.read();
+        is_torn = !is_consistent(state) || state.values[0] < last;
+        last = state.values[0];
+    }
+    writer.join();
+
+    REQUIRE_FALSE(is_torn);
+}
+
+TEST_CASE("RTOS seqlock vector test", "[rtos][seqlock]")
+{
+    emblib::rtos::seqlock<emblib::math::vector3f> lock;
+    emblib::math::vector3f value;
+
+    lock.write({1.0f, 2.0f, 3.0f});
+    REQUIRE(lock.try_read(value));
+    REQUIRE(value(2) == 3.0f);
+    REQUIRE(lock.read()(0) == 1.0f);
+}
@@ -0,0 +1,34 @@
+#include "emblib/rtos/shared_mutex.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <mutex>
+#include <shared_mutex>
+
+TEST_CASE("RTOS shared mutex test", "[rtos][shared_mutex]")
+{
+    emblib::rtos::shared_mutex mutex;
+
+    {
+        std::shared_lock<emblib::rtos::shared_mutex> reader_1(mutex);
+        std::shared_lock<emblib::rtos::shared_mutex> reader_2(mutex);
+        REQUIRE((reader_1.owns_lock() && reader_2.owns_lock()));
+        REQUIRE_FALSE(mutex.try_lock());
+    }
+
+    {
+        std::unique_lock<emblib::rtos::shared_mutex> writer(mutex, std::try_to_lock);
+        REQUIRE(writer.owns_lock());
+        REQUIRE_FALSE(mutex.try_lock_shared());
+    }
+
+    REQUIRE(mutex.try_lock_shared());
+    REQUIRE(mutex.unlock_shared());
+}
+
+TEST_CASE("RTOS recursive mutex test", "[rtos][mutex]")
+{
+    emblib::rtos::recursive_mutex mutex;
+
+    std::lock_guard<emblib::rtos::recursive_mutex> outer(mutex);
+    REQUIRE(mutex.lock());
+    REQUIRE(mutex.unlock());
+}
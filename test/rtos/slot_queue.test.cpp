@@ -0,0 +1,27 @@
+#include "emblib/rtos/slot_queue.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("RTOS slot queue test", "[rtos][slot_queue]")
+{
+    struct frame_s {
+        int id;
+        char payload[64];
+    };
+
+    emblib::rtos::slot_queue<frame_s, 2> queue;
+
+    frame_s* slot1 = queue.acquire(std::chrono::milliseconds(0));
+    frame_s* slot2 = queue.acquire(std::chrono::milliseconds(0));
+    REQUIRE((slot1 && slot2 && slot1 != slot2));
+    REQUIRE(queue.acquire(std::chrono::milliseconds(0)) == nullptr);
+
+    slot2->id = 2;
+    slot1->id = 1;
+    REQUIRE(queue.commit(slot2));
+    REQUIRE(queue.commit(slot1));
+
+    frame_s* received = queue.receive(std::chrono::milliseconds(0));
+    REQUIRE((received == slot2 && received->id == 2));
+    REQUIRE(queue.release(received));
+    REQUIRE(queue.acquire(std::chrono::milliseconds(0)) == slot2);
+}
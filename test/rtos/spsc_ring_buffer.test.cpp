@@ -0,0 +1,23 @@
+#include "emblib/rtos/spsc_ring_buffer.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+TEST_CASE("RTOS SPSC ring buffer test", "[rtos][spsc_ring_buffer]")
+{
+    emblib::rtos::spsc_ring_buffer<int, 4> buffer;
+    int to_write[] = {1, 2, 3, 4, 5};
+    int read[5] = {0};
+
+    REQUIRE(buffer.write(to_write, 3) == 3);
+    REQUIRE(buffer.read(read, 2) == 2);
+    REQUIRE((read[0] == 1 && read[1] == 2));
+
+    /* Wraps around the end of the storage */
+    REQUIRE(buffer.write(to_write + 1, 4) == 3);
+    REQUIRE(buffer.get_size() == 4);
+    REQUIRE_FALSE(buffer.write(5));
+
+    REQUIRE(buffer.read(read, 5) == 4);
+    REQUIRE((read[0] == 3 && read[1] == 2 && read[2] == 3 && read[3] == 4));
+    REQUIRE(buffer.is_empty());
+    REQUIRE_FALSE(buffer.read(read[0]));
+}
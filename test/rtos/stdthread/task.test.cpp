@@ -0,0 +1,131 @@
+#include "emblib/rtos/mutex.hpp"
+#include "emblib/rtos/queue.hpp"
+#include "emblib/rtos/semaphore.hpp"
+#include "emblib/rtos/task.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <mutex>
+#include <thread>
+
+namespace {
+
+constexpr size_t STACK_SIZE = 1024;
+constexpr size_t WORKER_COUNT = 4;
+constexpr uint32_t ITEM_COUNT = 10000;
+
+static emblib::rtos::queue<uint32_t, 16> items;
+static emblib::rtos::semaphore workers_done(WORKER_COUNT, 0);
+static emblib::rtos::mutex sum_mutex;
+static uint64_t sum = 0;
+static uint32_t notifications = 0;
+
+/**
+ * Sends all the items and waits for the workers to finish
+ */
+class producer_task : public emblib::rtos::task {
+public:
+    producer_task() : task("producer", 1, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        for (uint32_t i = 1; i <= ITEM_COUNT; i++) {
+            items.send(i);
+        }
+
+        /* Zero tells a worker to stop */
+        for (size_t i = 0; i < WORKER_COUNT; i++) {
+            items.send(0);
+        }
+        for (size_t i = 0; i < WORKER_COUNT; i++) {
+            workers_done.take();
+        }
+
+        while (wait_notification(emblib::rtos::ticks_t(0))) {
+            notifications++;
+        }
+        stop_tasks();
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+static producer_task* producer = nullptr;
+
+/**
+ * Adds up the received items under the mutex
+ */
+class worker_task : public emblib::rtos::task {
+public:
+    worker_task() : task("worker", 2, m_stack) {}
+
+private:
+    void run() noexcept override
+    {
+        uint32_t item = 0;
+        while (items.receive(item) && item != 0) {
+            std::lock_guard<emblib::rtos::mutex> lock(sum_mutex);
+            sum += item;
+        }
+        producer->notify();
+        workers_done.give();
+    }
+
+    emblib::rtos::task_stack_t<STACK_SIZE> m_stack;
+};
+
+}
+
+TEST_CASE("RTOS std::thread backend test", "[rtos][stdthread]")
+{
+    static producer_task producer_instance;
+    static worker_task workers[WORKER_COUNT];
+    producer = &producer_instance;
+
+    emblib::rtos::task::start_tasks();
+
+    REQUIRE(sum == uint64_t(ITEM_COUNT) * (ITEM_COUNT + 1) / 2);
+    REQUIRE(notifications == WORKER_COUNT);
+}
+
+TEST_CASE("RTOS std::thread backend timeout test", "[rtos][stdthread]")
+{
+    emblib::rtos::queue<int, 1> queue;
+    emblib::rtos::semaphore semaphore;
+    int item = 0;
+
+    REQUIRE(queue.send(1, emblib::rtos::ticks_t(0)));
+    REQUIRE_FALSE(queue.send(2, emblib::rtos::ticks_t(5)));
+    REQUIRE(queue.peek(item, emblib::rtos::ticks_t(0)));
+    REQUIRE(queue.receive(item, emblib::rtos::ticks_t(0)));
+    REQUIRE(item == 1);
+    REQUIRE_FALSE(queue.receive(item, emblib::rtos::ticks_t(5)));
+
+    REQUIRE_FALSE(semaphore.take(emblib::rtos::ticks_t(5)));
+    REQUIRE(semaphore.give());
+    REQUIRE_FALSE(semaphore.give());
+    REQUIRE(semaphore.take(emblib::rtos::ticks_t(0)));
+}
+
+TEST_CASE("RTOS std::thread backend mutex owner test", "[rtos][stdthread]")
+{
+    emblib::rtos::mutex mutex;
+    emblib::rtos::recursive_mutex recursive_mutex;
+    bool is_given = true;
+
+    /* Only the thread holding the mutex can give it, same as FreeRTOS */
+    REQUIRE_FALSE(mutex.unlock());
+    REQUIRE(mutex.lock());
+    REQUIRE_FALSE(mutex.try_lock());
+    REQUIRE_FALSE(mutex.lock(emblib::rtos::ticks_t(5)));
+    std::thread([&] {is_given = mutex.unlock();}).join();
+    REQUIRE_FALSE(is_given);
+    REQUIRE(mutex.unlock());
+
+    REQUIRE(recursive_mutex.lock());
+    REQUIRE(recursive_mutex.lock());
+    REQUIRE(recursive_mutex.unlock());
+    std::thread([&] {is_given = recursive_mutex.unlock();}).join();
+    REQUIRE_FALSE(is_given);
+    REQUIRE(recursive_mutex.unlock());
+    REQUIRE_FALSE(recursive_mutex.unlock());
+}
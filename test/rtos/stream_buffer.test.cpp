@@ -0,0 +1,16 @@
+#include "emblib/rtos/stream_buffer.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <cstring>
+
+TEST_CASE("RTOS stream buffer test", "[rtos][stream_buffer]")
+{
+    emblib::rtos::stream_buffer<8> stream;
+    const char to_send[] = "0123456789";
+    char buffer[10] = {0};
+
+    REQUIRE(stream.send(to_send, 10, std::chrono::milliseconds(0)) == 8);
+    REQUIRE(stream.get_available() == 8);
+    REQUIRE(stream.receive(buffer, 5, std::chrono::milliseconds(0)) == 5);
+    REQUIRE(stream.receive(buffer + 5, 5, std::chrono::milliseconds(0)) == 3);
+    REQUIRE(std::memcmp(buffer, to_send, 8) == 0);
+}
@@ -0,0 +1,34 @@
+#include "emblib/rtos/timer.hpp"
+#include "catch2/catch_test_macros.hpp"
+
+using emblib::rtos::timer;
+
+TEST_CASE("RTOS timer test", "[rtos][timer]")
+{
+    static timer blink("blink", std::chrono::milliseconds(10), timer::mode_e::PERIODIC, [] {});
+
+    REQUIRE_FALSE(blink.is_active());
+    REQUIRE(blink.get_period() == std::chrono::milliseconds(10));
+
+    /* Commands are only queued until the daemon task runs */
+    REQUIRE(blink.start(std::chrono::milliseconds(0)));
+    REQUIRE(blink.stop(std::chrono::milliseconds(0)));
+}
+
+TEST_CASE("RTOS timer callback test", "[.][rtos][timer][scheduler]")
+{
+    static int ticks = 0;
+    static timer periodic("periodic", std::chrono::milliseconds(10), timer::mode_e::PERIODIC, [] {
+        ticks++;
+    });
+    static timer one_shot("one_shot", std::chrono::milliseconds(55), timer::mode_e::ONE_SHOT, [] {
+        emblib::rtos::task::stop_tasks();
+    });
+
+    periodic.start();
+    one_shot.start();
+    emblib::rtos::task::start_tasks();
+
+    REQUIRE(ticks == 5);
+    REQUIRE_FALSE(one_shot.is_active());
+}
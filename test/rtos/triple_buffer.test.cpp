@@ -0,0 +1,69 @@
+#include "emblib/rtos/triple_buffer.hpp"
+#include "emblib/math/vector.hpp"
+#include "catch2/catch_test_macros.hpp"
+#include <algorithm>
+#include <thread>
+
+TEST_CASE("RTOS triple buffer test", "[rtos][triple_buffer]")
+{
+    emblib::rtos::triple_buffer<int> buffer(1);
+    int value = 0;
+
+    REQUIRE_FALSE(buffer.read(value));
+    REQUIRE(value == 1);
+
+    /* Only the latest value is kept */
+    buffer.write(2);
+    buffer.write(3);
+    REQUIRE(buffer.read(value));
+    REQUIRE(value == 3);
+    REQUIRE_FALSE(buffer.update());
+    REQUIRE(buffer.get() == 3);
+
+    buffer.write(4);
+    REQUIRE(buffer.update());
+    REQUIRE(buffer.get() == 4);
+}
+
+TEST_CASE("RTOS triple buffer concurrent test", "[rtos][triple_buffer]")
+{
+    struct state_s {
+        uint32_t values[8];
+    };
+    static emblib::rtos::triple_buffer<state_s> buffer;
+    constexpr uint32_t WRITE_COUNT = 100000;
+
+    std::thread writer([] {
+        for (uint32_t i = 1; i <= WRITE_COUNT; i++) {
+            state_s state;
+            std::fill(std::begin(state.values), std::end(state.values), i);
+            buffer.write(state);
+        }
+    });
+
+    bool is_torn = false;
+    uint32_t last = 0;
+    while (last < WRITE_COUNT && !is_torn) {
+        if (!buffer.update())
+            continue;
+        const state_s& state = buffer.get();
+        for (uint32_t value : state.values)
+            is_torn |= value != state.values[0];
+        is_torn |= state.values[0] <= last;
+        last = state.values[0];
+    }
+    writer.join();
+
+    REQUIRE_FALSE(is_torn);
+}
+
+TEST_CASE("RTOS triple buffer vector test", "[rtos][triple_buffer]")
+{
+    emblib::rtos::triple_buffer<emblib::math::vector3f> buffer;
+    emblib::math::vector3f value;
+
+    buffer.write({1.0f, 2.0f, 3.0f});
+    REQUIRE(buffer.read(value));
+    REQUIRE(value(2) == 3.0f);
+    REQUIRE(buffer.get()(0) == 1.0f);
+}